@@ -14,6 +14,8 @@ var time_multiplier: float = 0.0027778
 
 var time: float = 0.0
 var max_enemy_count: int
+var enemy_count_handle: int = -1
+var enemy_prefab_handles: Dictionary[String, int] = {}
 
 @onready var world: FlecsWorld = $".."
 @onready var terrain: MeshInstance2D = $"../../Terrain"
@@ -35,6 +37,10 @@ func _ready() -> void:
 		set_process(false)
 		return
 
+	enemy_count_handle = world.get_component_handle(ECS.components.stagehand_demos.surwave.EnemyCount)
+	for enemy_type in ["BugSmall", "BugHumanoid", "BugLarge"]:
+		enemy_prefab_handles[enemy_type] = world.get_prefab_handle(_enemy_prefab_path_for_type(enemy_type))
+
 	# Prefer configuration from the ECS WorldConfiguration singleton when present.
 	var config = world.get_component(ECS.components.stagehand.WorldConfiguration)
 	if typeof(config) == TYPE_DICTIONARY and config.has("enemy_count"):
@@ -48,7 +54,7 @@ func _ready() -> void:
 func _process(delta: float) -> void:
 	time += delta
 	
-	var current_enemy_count = world.get_component(ECS.components.stagehand_demos.surwave.EnemyCount)
+	var current_enemy_count = world.get_component_by_handle(enemy_count_handle)
 	if current_enemy_count >= max_enemy_count:
 		return # Rendering limit reached; can't spawn any more
 	
@@ -57,13 +63,13 @@ func _process(delta: float) -> void:
 	var should_spawn: bool = randf() < prob_curve_sample
 	if should_spawn:
 		var picked_enemy_type: String = _pick_enemy_type(scaled_time)
-		var prefab_path: String = _enemy_prefab_path_for_type(picked_enemy_type)
-		if prefab_path.is_empty():
+		var prefab_handle: int = enemy_prefab_handles.get(picked_enemy_type, -1)
+		if prefab_handle < 0:
 			return
 		var spawn_position: Vector2 = _pick_spawn_position()
 
 		var spawn_transform := Transform2D(0, spawn_position)
-		world.instantiate_prefab(prefab_path, {
+		world.instantiate_prefab_by_handle(prefab_handle, {
 			ECS.components.stagehand.transform.Transform2D_: spawn_transform,
 			ECS.components.stagehand.transform.Position2D: spawn_position,
 		})
@@ -7,13 +7,12 @@ class_name GemDropManager extends Node
 @onready var world: FlecsWorld = $".."
 
 func _ready() -> void:
-	world.stagehand_signal_emitted.connect(_on_flecs_signal)
+	world.connect_event(&"enemy_died", _on_enemy_died)
 
 
-func _on_flecs_signal(signal_name: StringName, data: Dictionary) -> void:
-	if signal_name == "enemy_died":
-		var drop_chance := drop_probabilities[data.get("enemy_type")]
-		if randf() < drop_chance:
-			var gem = gem_scene.instantiate() as Node2D
-			gem.global_position = data.enemy_position
-			add_child(gem)
+func _on_enemy_died(data: Dictionary, _source_entity_id: int) -> void:
+	var drop_chance := drop_probabilities[data.get("enemy_type")]
+	if randf() < drop_chance:
+		var gem = gem_scene.instantiate() as Node2D
+		gem.global_position = data.enemy_position
+		add_child(gem)
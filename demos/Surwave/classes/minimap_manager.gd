@@ -13,7 +13,6 @@ var stage: Stage
 var stage_bounds: Rect2
 var world: FlecsWorld
 var camera_node: Camera2D
-var enemy_multimesh: MultiMesh
 var minimap_ready: bool = false
 var cached_altar_points: PackedVector2Array = PackedVector2Array()
 var cached_altar_states: PackedFloat32Array = PackedFloat32Array()
@@ -44,8 +43,6 @@ func _initialise_minimap() -> void:
 	stage_bounds = stage.get_stage_bounds()
 	world = stage.world
 	camera_node = stage.get_node_or_null("Camera")
-	var enemies_instance: MultiMeshInstance2D = stage.get_node_or_null("World/Enemies")
-	enemy_multimesh = enemies_instance.multimesh if enemies_instance else null
 	cached_altar_points = _build_altar_points(stage.get_altar_positions())
 	cached_altar_states = _build_altar_states(stage.get_altar_states())
 	minimap_material.set_shader_parameter("altar_points", cached_altar_points)
@@ -132,18 +129,19 @@ func _update_altar_markers() -> void:
 
 func _sample_enemy_positions() -> PackedVector2Array:
 	var positions := PackedVector2Array()
-	if enemy_multimesh == null or stage_bounds.size == Vector2.ZERO:
+	if world == null or stage_bounds.size == Vector2.ZERO:
 		return positions
-	var visible_count: int = enemy_multimesh.visible_instance_count
-	if visible_count <= 0 or visible_count > enemy_multimesh.instance_count:
-		visible_count = enemy_multimesh.instance_count
-	if visible_count <= 0:
+	var column: Dictionary = world.get_component_column(ECS.components.stagehand.transform.Position2D, "stagehand_demos::surwave::Enemy")
+	if column.is_empty():
 		return positions
-	var ratio: float = float(visible_count) / float(MAX_ENEMY_SAMPLES)
+	var enemy_positions: PackedVector2Array = column["values"]
+	var enemy_count: int = enemy_positions.size()
+	if enemy_count <= 0:
+		return positions
+	var ratio: float = float(enemy_count) / float(MAX_ENEMY_SAMPLES)
 	var stride: int = max(int(ceil(ratio)), 1)
-	for instance_index in range(0, visible_count, stride):
-		var transform: Transform2D = enemy_multimesh.get_instance_transform_2d(instance_index)
-		positions.append(_normalise_point(transform.origin))
+	for enemy_index in range(0, enemy_count, stride):
+		positions.append(_normalise_point(enemy_positions[enemy_index]))
 		if positions.size() >= MAX_ENEMY_SAMPLES:
 			break
 	return positions
@@ -192,16 +192,17 @@ func _spawn_initial_enemy_population() -> void:
 			if prefab_path.is_empty():
 				continue
 			var transforms: Array = []
+			var positions := PackedVector2Array()
 			
 			for i in range(count):
 				var transform: Transform2D = _get_random_spawn_transform()
 				transforms.append(transform)
+				positions.append(transform.origin)
 
-			for transform in transforms:
-				world.instantiate_prefab(prefab_path, {
-					ECS.components.stagehand.transform.Transform2D_: transform,
-					ECS.components.stagehand.transform.Position2D: transform.origin,
-				})
+			world.instantiate_prefab_batch(prefab_path, count, {
+				ECS.components.stagehand.transform.Transform2D_: transforms,
+				ECS.components.stagehand.transform.Position2D: positions,
+			})
 		spawn_iteration_counter += 1
 
 
@@ -29,23 +29,22 @@ func connect_to_flecs_signal():
 	if world == null:
 		push_warning("AudioManager: connect_to_flecs_signal called but the world instance is null")
 		return
-	world.stagehand_signal_emitted.connect(_on_flecs_signal)
-
-
-func _on_flecs_signal(signal_name: StringName, data: Dictionary) -> void:
-	var enemy_type := String(data.get("enemy_type", ""))
-
-	match signal_name:
-		"enemy_died":
-			match enemy_type:
-				"BugSmall": await _delay(); bug_small_die.play()
-				"BugHumanoid": await _delay(); bug_humanoid_die.play()
-				"BugLarge": await _delay(); bug_large_die.play()
-		"enemy_took_damage":
-			match enemy_type:
-				"BugSmall": bug_small_hurt.play()
-				"BugHumanoid": bug_humanoid_hurt.play()
-				"BugLarge": bug_large_hurt.play()
+	world.connect_event(&"enemy_died", _on_enemy_died)
+	world.connect_event(&"enemy_took_damage", _on_enemy_took_damage)
+
+
+func _on_enemy_died(data: Dictionary, _source_entity_id: int) -> void:
+	match String(data.get("enemy_type", "")):
+		"BugSmall": await _delay(); bug_small_die.play()
+		"BugHumanoid": await _delay(); bug_humanoid_die.play()
+		"BugLarge": await _delay(); bug_large_die.play()
+
+
+func _on_enemy_took_damage(data: Dictionary, _source_entity_id: int) -> void:
+	match String(data.get("enemy_type", "")):
+		"BugSmall": bug_small_hurt.play()
+		"BugHumanoid": bug_humanoid_hurt.play()
+		"BugLarge": bug_large_hurt.play()
 
 
 func _delay(delay: float = 0.5):
@@ -110,7 +110,7 @@ func _ready() -> void:
 	health_bar.value = health_bar.max_value
 	health_bar_original_modulation = health_bar.modulate
 	
-	world.stagehand_signal_emitted.connect(_on_flecs_signal)
+	world.connect_event(&"enemy_hit_player", _on_enemy_hit_player)
 	
 		
 func _process(delta: float) -> void:
@@ -248,23 +248,22 @@ func _on_health_bar_value_changed(value: float) -> void:
 	fill_style.bg_color = health_bar_empty_colour.lerp(health_bar_full_colour, health_bar.value / health_bar.max_value)
 
 
-func _on_flecs_signal(signal_name: StringName, data: Dictionary) -> void:
+func _on_enemy_hit_player(data: Dictionary, _source_entity_id: int) -> void:
 	if is_dead: return
-	if signal_name == "enemy_hit_player":
-		if (damage_cooldown_timer.time_left > 0): return
-		
-		player_took_damage.emit()
-		AudioManager.player_hurt.play()
-		
-		health -= data.damage_amount
-		health_bar.value = max(health / max_health, 0)
-		health_bar.modulate = Color.WHITE
-		
-		if health > 0:
-			damage_cooldown_timer.start()
-		else:
-			await _handle_death()
-			health_bar.visible = false
+	if (damage_cooldown_timer.time_left > 0): return
+	
+	player_took_damage.emit()
+	AudioManager.player_hurt.play()
+	
+	health -= data.damage_amount
+	health_bar.value = max(health / max_health, 0)
+	health_bar.modulate = Color.WHITE
+	
+	if health > 0:
+		damage_cooldown_timer.start()
+	else:
+		await _handle_death()
+		health_bar.visible = false
 
 
 func _handle_death() -> void:
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "stagehand/ecs/components/simulation_lod.h"
 #include "stagehand/registry.h"
 
 #include "demos/ecs/surwave/components/enemy.h"
@@ -25,6 +26,7 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
                       .set<HFlipTimer>({0.5f})
                       .set<VFlipTimer>({0.5f})
                       .set<ProjectileHitTimeout>({0.0f})
-                      .set<ShockwaveHitTimeout>({0.0f});
+                      .set<ShockwaveHitTimeout>({0.0f})
+                      .add<stagehand::lod::SimulationLod>();
     // clang-format on
 });
@@ -11,5 +11,6 @@
 #include "systems/enemy_hit_player.h"
 #include "systems/enemy_movement.h"
 #include "systems/enemy_take_damage.h"
+#include "systems/simulation_lod_reference_update.h"
 #include "systems/timer_tick.h"
 #include "systems/velocity_to_position.h"
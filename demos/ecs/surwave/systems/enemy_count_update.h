@@ -4,6 +4,7 @@
 
 #include "demos/ecs/surwave/components/singletons.h"
 #include "demos/ecs/surwave/prefabs/enemy.h"
+#include "demos/ecs/surwave/utilities/enemy_constants.h"
 
 using namespace stagehand_demos::surwave;
 
@@ -14,6 +15,7 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
     world.system<>("Enemy Count Update")
         .with<EnemyCount>().inout()
         .kind(flecs::PostUpdate)
+        .interval(1.0f / kEnemyCountUpdateRate)
         .run([enemy_instance_query](flecs::iter &it) {
         // clang-format on
         while (it.next()) {
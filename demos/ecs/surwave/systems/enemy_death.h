@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <utility>
 #include <cstdint>
 
 #include <godot_cpp/variant/dictionary.hpp>
@@ -36,6 +37,7 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
     >("Enemy Death")
         .with(flecs::IsA, EnemyPrefab)
         .kind(flecs::OnValidate)
+        .multi_threaded()
         .run([](flecs::iter &it) {
             // clang-format on
             while (it.next()) {
@@ -61,11 +63,11 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
                     signal_data["enemy_type"] = enemy_type::from_entity_prefab(entity);
                     signal_data["enemy_position"] = positions[entity_index];
 
-                    // Emit signal using Stagehand's emit_signal helper
+                    // Queued in this worker's lane and emitted on the main thread after OnRender
                     stagehand::EventPayload payload;
                     payload.name = "enemy_died";
-                    payload.data = signal_data;
-                    stagehand::emit_signal(it, entity_index, payload);
+                    payload.data = std::move(signal_data);
+                    stagehand::emit_signal(it, entity_index, std::move(payload));
 
                     hit_points[entity_index].value = invulnerable_hit_points;
                     death_timer[entity_index].value = death_animation_duration;
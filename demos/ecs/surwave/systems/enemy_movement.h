@@ -10,12 +10,14 @@
 #include <godot_cpp/variant/vector2.hpp>
 
 #include "stagehand/ecs/components/physics.h"
+#include "stagehand/ecs/components/simulation_lod.h"
 #include "stagehand/ecs/components/transform.h"
 #include "stagehand/registry.h"
 
 #include "demos/ecs/surwave/components/enemy.h"
 #include "demos/ecs/surwave/components/singletons.h"
 #include "demos/ecs/surwave/prefabs/enemy.h"
+#include "demos/ecs/surwave/utilities/enemy_constants.h"
 #include "demos/ecs/surwave/utilities/enemy_kd_tree.h"
 
 using namespace stagehand_demos::surwave;
@@ -29,6 +31,7 @@ namespace enemy_movement {
         godot::Vector2 *position;
         godot::Vector2 *velocity;
         float max_speed;
+        std::uint8_t lod_tier;
     };
 
     struct KdTreeCache {
@@ -81,7 +84,8 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
         const PlayerPosition,
         const EnemyBoidMovementSettings,
         const MovementSpeed,
-        const DeathTimer
+        const DeathTimer,
+        const stagehand::lod::SimulationLod
     >("Enemy Movement")
         .with(flecs::IsA, EnemyPrefab)
         .run([](flecs::iter &it) {
@@ -109,6 +113,7 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
                 flecs::field<const EnemyBoidMovementSettings> movement_settings_field = it.field<const EnemyBoidMovementSettings>(3);
                 flecs::field<const MovementSpeed> movement_speeds = it.field<const MovementSpeed>(4);
                 flecs::field<const DeathTimer> death_timers = it.field<const DeathTimer>(5);
+                flecs::field<const stagehand::lod::SimulationLod> simulation_lods = it.field<const stagehand::lod::SimulationLod>(6);
 
                 player_position = &player_position_field[0];
                 movement_settings = &movement_settings_field[0];
@@ -120,7 +125,8 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
                     }
                     const flecs::entity current_entity = it.entity(static_cast<int32_t>(row_index));
                     enemy_movement::BoidAccessor accessor{current_entity.id(), &positions[row_index], &velocities[row_index],
-                                                          godot::Math::max(movement_speeds[row_index].value * max_speed_multiplier, 1.0f)};
+                                                          godot::Math::max(movement_speeds[row_index].value * max_speed_multiplier, 1.0f),
+                                                          simulation_lods[row_index].tier};
                     boids.push_back(accessor);
                 }
             }
@@ -207,7 +213,15 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
             }
             kd_cache.cached_count = enemy_count;
 
+            // Every boid stays in the KD-tree as a neighbour, but distant ones steer less often, with a correspondingly longer time step.
+            const int64_t frame = it.world().get_info()->frame_count_total;
             for (size_t entity_index = 0; entity_index < enemy_count; ++entity_index) {
+                const std::uint8_t lod_tier = boids[entity_index].lod_tier;
+                if (!stagehand::lod::is_update_frame(kEnemyMovementLodIntervals, lod_tier, boids[entity_index].entity_id, frame)) {
+                    continue;
+                }
+                const float steering_delta_time = stagehand::lod::scaled_delta_time(kEnemyMovementLodIntervals, lod_tier, delta_time);
+
                 const godot::Vector2 position_value = *boids[entity_index].position;
                 const godot::Vector2 current_velocity = *boids[entity_index].velocity;
                 const float max_speed = boids[entity_index].max_speed;
@@ -269,7 +283,7 @@ REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
 
                 acceleration = enemy_movement::limit_vector_squared(acceleration, max_force * max_force);
 
-                godot::Vector2 new_velocity = current_velocity + acceleration * delta_time;
+                godot::Vector2 new_velocity = current_velocity + acceleration * steering_delta_time;
                 new_velocity = enemy_movement::limit_vector_squared(new_velocity, max_speed * max_speed);
 
                 *boids[entity_index].velocity = new_velocity;
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <godot_cpp/variant/vector3.hpp>
+
+#include "stagehand/ecs/components/simulation_lod.h"
+#include "stagehand/registry.h"
+
+#include "demos/ecs/surwave/components/singletons.h"
+
+using namespace stagehand_demos::surwave;
+
+REGISTER_IN_MODULE(stagehand_demos::surwave, [](flecs::world &world) {
+    // Measures the enemies' simulation LOD tiers from the player, before they are reassigned in PreUpdate.
+    // clang-format off
+    world.system<const PlayerPosition, stagehand::lod::SimulationLodSettings>("Simulation LOD Reference Update")
+        .kind(flecs::OnLoad)
+        .each([](const PlayerPosition &player_position, stagehand::lod::SimulationLodSettings &settings) {
+            // clang-format on
+            settings.reference_point = godot::Vector3(player_position.x, player_position.y, 0.0f);
+        });
+});
@@ -4,6 +4,12 @@
 
 #include <godot_cpp/core/math_defs.hpp>
 
+#include "stagehand/ecs/components/simulation_lod.h"
+
 namespace stagehand_demos::surwave {
     inline constexpr float kEnemyDeathInvulnerableHitPoints = std::numeric_limits<float>::max();
+    /// Times per second the EnemyCount singleton is refreshed. The spawn manager only uses it as a soft cap, so it may lag a few frames.
+    inline constexpr float kEnemyCountUpdateRate = 5.0f;
+    /// Frames between two steering updates of an enemy in each simulation LOD tier, from nearest to the player to farthest.
+    inline constexpr stagehand::lod::TierIntervals kEnemyMovementLodIntervals = {1, 2, 4, 8};
 }
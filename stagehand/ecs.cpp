@@ -1,8 +1,15 @@
 // IWYU pragma: begin_keep
 #include "stagehand/ecs/prefabs/entity.h"
+#include "stagehand/ecs/systems/event_queues.h"
+#include "stagehand/ecs/systems/interpolation.h"
+#include "stagehand/ecs/systems/parallelism.h"
 #include "stagehand/ecs/systems/physics.h"
 #include "stagehand/ecs/systems/rendering_instanced.h"
 #include "stagehand/ecs/systems/rendering_multimesh.h"
+#include "stagehand/ecs/systems/simulation_lod.h"
+#include "stagehand/ecs/systems/staggered.h"
 #include "stagehand/ecs/systems/tag_reset.h"
+#include "stagehand/ecs/systems/task.h"
+#include "stagehand/ecs/systems/time_sliced.h"
 #include "stagehand/ecs/systems/transform.h"
 // IWYU pragma: end_keep
@@ -1,11 +1,16 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 
+#include "flecs.h"
+
 #include "stagehand/registry.h"
+#include "stagehand/utilities/per_stage_queue.h"
 
 namespace stagehand {
 
@@ -16,5 +21,23 @@ namespace stagehand {
         uint64_t source_entity_id = 0;
     };
 
-    REGISTER([](flecs::world &world) { world.component<EventPayload>("stagehand::EventPayload"); });
+    /// Singleton holding the payloads queued by stagehand::emit_signal(), one lane per stage. The queue is drained on the main thread after
+    /// OnRender (see stagehand/ecs/systems/event_queues.h), where each payload is emitted as a Flecs EventPayload event.
+    struct SignalQueue {
+        PerStageQueue<EventPayload> payloads;
+        /// Lane being emitted while the queue is drained.
+        std::vector<EventPayload> draining;
+        /// Entity that payloads without a (live) source entity are emitted from. Flecs requires emitted events to have an entity.
+        flecs::entity_t no_source_emitter = 0;
+    };
+
+    REGISTER([](flecs::world &world) {
+        world.component<EventPayload>("stagehand::EventPayload");
+
+        SignalQueue signal_queue;
+        signal_queue.no_source_emitter = world.entity("stagehand::internal::no_source_event_emitter").id();
+        signal_queue.payloads.prepare(world);
+        world.component<SignalQueue>("stagehand::SignalQueue").add(flecs::Singleton);
+        world.set<SignalQueue>(std::move(signal_queue));
+    });
 } // namespace stagehand
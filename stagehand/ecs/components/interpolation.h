@@ -0,0 +1,45 @@
+#pragma once
+
+#include <godot_cpp/variant/transform2d.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/macros.h"
+#include "stagehand/ecs/components/transform.h"
+#include "stagehand/registry.h"
+
+namespace stagehand::interpolation {
+    /// The value a transform component had at the start of the current fixed tick. Renderers blend from it to the current value by
+    /// InterpolationAlpha in PROGRESS_TICK_FIXED mode, so a simulation running at a lower rate than the display still moves smoothly.
+    /// Opt in per entity or prefab, for the transform type the renderer reads:
+    ///   world.prefab("Bullet").add<stagehand::interpolation::Previous<godot::Transform2D>>();
+    /// Entities that MultiMesh renderers draw from their RenderTransform2D/3D are blended from the transform component instead:
+    ///   world.prefab("Bullet").add<stagehand::interpolation::Previous<stagehand::transform::Transform2D>>();
+    template <typename TransformType> struct Previous {
+        TransformType value;
+        /// False until the first snapshot, so entities spawned during a tick are drawn where they are instead of blending from the origin.
+        bool is_set = false;
+    };
+
+    /// Singleton with how far the displayed frame is between the previous and the current fixed tick, in [0, 1).
+    /// Set by FlecsWorld before the presentation phases run; 1 outside of PROGRESS_TICK_FIXED mode, which means "don't interpolate".
+    FLOAT_(InterpolationAlpha, 1.0f).then([](auto c) { c.add(flecs::Singleton); });
+
+    /// Returns the transform to draw: `current`, or the blend from the previous tick when interpolating.
+    template <typename TransformType>
+    [[nodiscard]] inline TransformType interpolate(const Previous<TransformType> &previous, const TransformType &current, float alpha) {
+        if (!previous.is_set || previous.value == current) {
+            return current;
+        }
+        return previous.value.interpolate_with(current, alpha);
+    }
+
+    REGISTER([](flecs::world &world) {
+        // Instances get their own copy when the component is added to a prefab, since every entity has its own previous transform.
+        world.component<Previous<godot::Transform2D>>("stagehand::interpolation::PreviousGodotTransform2D").add(flecs::OnInstantiate, flecs::Override);
+        world.component<Previous<godot::Transform3D>>("stagehand::interpolation::PreviousGodotTransform3D").add(flecs::OnInstantiate, flecs::Override);
+        world.component<Previous<transform::Transform2D>>("stagehand::interpolation::PreviousTransform2D").add(flecs::OnInstantiate, flecs::Override);
+        world.component<Previous<transform::Transform3D>>("stagehand::interpolation::PreviousTransform3D").add(flecs::OnInstantiate, flecs::Override);
+    });
+} // namespace stagehand::interpolation
@@ -272,6 +272,14 @@ namespace stagehand::internal {
             comp.template member<FieldType>(name_str.c_str());
         });
     }
+
+    /// Converts a PFR-reflectable aggregate into a Dictionary keyed by field name.
+    template <typename T> godot::Dictionary struct_to_dictionary(const T &value) {
+        godot::Dictionary dict;
+        pfr::for_each_field_with_name(
+            value, [&dict](std::string_view name, const auto &field) { dict[godot::String(std::string(name).c_str())] = godot::Variant(field); });
+        return dict;
+    }
 } // namespace stagehand::internal
 
 namespace stagehand {
@@ -283,7 +291,7 @@ namespace stagehand {
         const flecs::component<T> component_handle = world.component<T>();
         const flecs::entity_t comp_id = component_handle.id();
 
-        ComponentGetter getter = [](const flecs::world &w, flecs::entity_t eid) -> godot::Variant {
+        ComponentGetter getter = [](const flecs::world &w, flecs::entity_t eid, const godot::StringName &) -> godot::Variant {
             const T *data = nullptr;
             if (eid == 0) {
                 data = w.try_get<T>();
@@ -295,17 +303,14 @@ namespace stagehand {
                 data = flecs::entity(w, eid).try_get<T>();
             }
             if (data) {
-                godot::Dictionary dict;
-                pfr::for_each_field_with_name(
-                    *data, [&dict](std::string_view name, const auto &field) { dict[godot::String(std::string(name).c_str())] = godot::Variant(field); });
-                return godot::Variant(dict);
+                return godot::Variant(internal::struct_to_dictionary(*data));
             }
             return godot::Variant(godot::Dictionary());
         };
 
-        ComponentSetter setter = [component_name = std::string(fallback_name)](flecs::world &w, flecs::entity_t eid, const godot::Variant &v) {
+        ComponentSetter setter = [](flecs::world &w, flecs::entity_t eid, const godot::Variant &v, const godot::StringName &component_name) {
             if (v.get_type() != godot::Variant::DICTIONARY) {
-                godot::UtilityFunctions::push_warning(godot::String("Failed to set struct component '") + component_name.c_str() +
+                godot::UtilityFunctions::push_warning(godot::String("Failed to set struct component '") + component_name +
                                                       "'. Expected Dictionary, got " + godot::Variant::get_type_name(v.get_type()));
                 return;
             }
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "flecs.h"
+
+#include "stagehand/registry.h"
+
+namespace stagehand {
+    /// Number of entities an adaptive system processed since the last parallelism update. Workers add the size of every batch they
+    /// process, so it is shared (and atomic) between the two variants of the system and all the threads they run on.
+    struct ParallelismCounter {
+        std::atomic<int32_t> processed_entities = 0;
+    };
+
+    /// Set on the multi-threaded variant of a system registered with register_adaptive_system(). Before every frame, the variant that fits
+    /// the number of entities the system processed in the previous frame is enabled and the other one disabled, so small workloads don't
+    /// pay for waking up and synchronising the worker threads.
+    struct ParallelismPolicy {
+        /// Fewest processed entities for which the system is split across threads. Once multi-threaded, the system stays so until it
+        /// processes fewer than half of this, so a workload around the threshold doesn't make it switch every frame.
+        int32_t min_entities = 0;
+        /// The single-threaded variant of the system.
+        flecs::entity_t single_threaded_system = 0;
+        std::shared_ptr<ParallelismCounter> counter;
+        /// Entities processed in the frame the current mode was chosen from.
+        int32_t processed_entities = 0;
+        bool multi_threaded = true;
+        /// How often the system switched between its variants.
+        int64_t switches = 0;
+        /// Set while the variant the policy enabled has been disabled by someone else. The policy then leaves both variants alone until
+        /// that variant is enabled again.
+        bool user_disabled = false;
+    };
+
+    REGISTER([](flecs::world &world) { world.component<ParallelismPolicy>("stagehand::ParallelismPolicy"); });
+} // namespace stagehand
@@ -7,6 +7,7 @@
 
 #include <godot_cpp/classes/multi_mesh.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/core/object_id.hpp>
 #include <godot_cpp/variant/rid.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 
@@ -26,6 +27,12 @@ namespace stagehand::rendering {
     };
 
     struct MultiMeshRendererConfig {
+        /// A query result in the last full upload of a renderer with incremental updates: its transform column and size.
+        struct UploadedSlice {
+            const void *transforms = nullptr;
+            uint32_t count = 0;
+        };
+
         godot::RID rid;
         // One MultiMeshInstance can render multiple prefab types. Store a list of queries (one per prefab) for each renderer.
         std::vector<flecs::query<>> queries;
@@ -34,6 +41,20 @@ namespace stagehand::rendering {
         bool use_custom_data;
         uint32_t instance_count;
         uint32_t visible_instance_count;
+        /// Only re-pack and upload the query results whose table changed since the last frame. The queries detect changes when it's set.
+        bool incremental_updates = false;
+        /// The buffer layout of the last full upload, in buffer order. Empty until the first one, and after the MultiMesh is reallocated.
+        std::vector<UploadedSlice> uploaded_slices;
+        /// Whether the last full upload blended transforms. When interpolation starts or stops, instances change without their table
+        /// changing, so that frame needs a full upload.
+        bool uploaded_interpolating = false;
+        /// Only pack and upload the instances that may be visible to the active camera of the renderer node's viewport. Culled frames are
+        /// always full uploads, since the visible instances change with the camera.
+        bool culling = false;
+        /// How far outside the view an instance's origin can be and still be drawn, in the renderer's local space.
+        float cull_margin = 0.0f;
+        /// The renderer node, which culling gets the viewport and its camera from.
+        godot::ObjectID node_id;
     };
 
     // ── Instanced Renderer Types ─────────────────────────────────────────────
@@ -67,6 +88,8 @@ namespace stagehand::rendering {
         std::vector<InstancedRendererLODConfig> lod_configs;
         flecs::query<> reconcile_query;
         flecs::query<> transform_update_query;
+        /// Entities with Previous<Transform3D>, whose transform is re-blended every displayed frame while interpolating.
+        flecs::query<> interpolation_query;
         std::vector<UniformInitConfig> initial_uniforms;
         std::vector<UniformUpdateConfig> uniform_updates;
 
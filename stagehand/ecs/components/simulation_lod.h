@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <godot_cpp/variant/vector3.hpp>
+
+#include "flecs.h"
+
+#include "stagehand/registry.h"
+
+namespace stagehand::lod {
+    /// Number of simulation LOD tiers. Tier 0 is nearest to the reference point, the last tier farthest from it.
+    constexpr int32_t TIER_COUNT = 4;
+    /// SimulationLod::tier of an entity that hasn't been assigned a tier yet. Updated like tier 0.
+    constexpr uint8_t UNASSIGNED_TIER = 0xFF;
+
+    /// Per-tier update intervals, in frames: an entity in tier t is updated every intervals[t] frames.
+    using TierIntervals = std::array<int32_t, TIER_COUNT>;
+
+    /// Toggleable tag for each tier. Every entity with SimulationLod has all of them, and only the one of its tier is enabled, so a system
+    /// can match the entities of a single tier with `.with<lod::Tier<0>>()`.
+    template <int32_t N> struct Tier {};
+
+    /// Opts an entity into simulation LOD. The "Assign Simulation LOD Tiers" systems set its tier from the distance between its Position2D
+    /// or Position3D and SimulationLodSettings::reference_point.
+    struct SimulationLod {
+        uint8_t tier = UNASSIGNED_TIER;
+    };
+
+    /// Singleton with the reference point (usually the player or the camera) and the tier boundaries.
+    struct SimulationLodSettings {
+        /// 2D positions are compared with its x and y.
+        godot::Vector3 reference_point;
+        /// Distances from the reference point at which tiers 1, 2 and 3 start.
+        std::array<float, TIER_COUNT - 1> tier_distances = {512.0f, 1024.0f, 2048.0f};
+        /// Number of frames a full reassignment is spread across. Each frame reassigns a different 1/reassignment_slices of the entities.
+        int32_t reassignment_slices = 4;
+    };
+
+    /// Returns the tier of an entity at `distance_squared` from the reference point.
+    [[nodiscard]] inline uint8_t tier_for_distance_squared(const SimulationLodSettings &settings, float distance_squared) {
+        uint8_t tier = 0;
+        while (tier < TIER_COUNT - 1 && distance_squared >= settings.tier_distances[tier] * settings.tier_distances[tier]) {
+            ++tier;
+        }
+        return tier;
+    }
+
+    /// Returns the update interval of `tier`, in frames. Unassigned entities update every frame.
+    [[nodiscard]] inline int32_t tier_interval(const TierIntervals &intervals, uint8_t tier) {
+        const int32_t interval = tier < TIER_COUNT ? intervals[tier] : 1;
+        return interval > 1 ? interval : 1;
+    }
+
+    /// Returns whether an entity in `tier` is updated in `frame`. Entities of one tier are spread evenly over its interval by their id, so
+    /// the work of a tier doesn't all land on the same frame.
+    [[nodiscard]] inline bool is_update_frame(const TierIntervals &intervals, uint8_t tier, flecs::entity_t entity, int64_t frame) {
+        const uint64_t interval = static_cast<uint64_t>(tier_interval(intervals, tier));
+        return (static_cast<uint64_t>(static_cast<uint32_t>(entity)) + static_cast<uint64_t>(frame)) % interval == 0;
+    }
+
+    /// Returns the time since an entity in `tier` was last updated, assuming the frame time stayed the same.
+    [[nodiscard]] inline float scaled_delta_time(const TierIntervals &intervals, uint8_t tier, float delta_time) {
+        return delta_time * static_cast<float>(tier_interval(intervals, tier));
+    }
+
+    REGISTER([](flecs::world &world) {
+        flecs::entity tier_tags[TIER_COUNT] = {
+            world.component<Tier<0>>("stagehand::lod::Tier0").add(flecs::CanToggle),
+            world.component<Tier<1>>("stagehand::lod::Tier1").add(flecs::CanToggle),
+            world.component<Tier<2>>("stagehand::lod::Tier2").add(flecs::CanToggle),
+            world.component<Tier<3>>("stagehand::lod::Tier3").add(flecs::CanToggle),
+        };
+        flecs::component<SimulationLod> simulation_lod = world.component<SimulationLod>("stagehand::lod::SimulationLod");
+        // Instances get their own tier, since it depends on where each entity is.
+        simulation_lod.add(flecs::OnInstantiate, flecs::Override);
+        for (flecs::entity tier_tag : tier_tags) {
+            simulation_lod.add(flecs::With, tier_tag);
+        }
+
+        world.component<SimulationLodSettings>("stagehand::lod::SimulationLodSettings").add(flecs::Singleton);
+        world.set<SimulationLodSettings>({});
+    });
+} // namespace stagehand::lod
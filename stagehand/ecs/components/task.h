@@ -0,0 +1,301 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "flecs.h"
+
+#include "stagehand/registry.h"
+#include "stagehand/utilities/worker_thread_pool_tasks.h"
+
+namespace stagehand {
+    class TaskScheduler;
+
+    /// A coroutine that runs across several frames, spawned with spawn_task(). Between co_awaits it runs on the thread that progresses the
+    /// world, in a "Resume Tasks" system, so it can use the world like any single-threaded system: structural changes are deferred to the
+    /// end of the phase it runs in.
+    ///   stagehand::task bake(flecs::world &world) {
+    ///       co_await stagehand::parallel_for(world, count, [&](int32_t i) { ... });   // Off the main thread, without blocking the frame
+    ///       co_await stagehand::phase(stagehand::OnLateUpdate);
+    ///       world.entity().set<Baked>({...});
+    ///       co_await stagehand::next_frame();
+    ///       ...
+    ///   }
+    /// A task must not wait on anything but these awaitables, since only the scheduler may resume it. Take the world by reference: a
+    /// flecs::world copy holds a reference to the world, which would then never be destroyed, and the task with it.
+    class task {
+      public:
+        struct promise_type {
+            TaskScheduler *scheduler = nullptr;
+
+            task get_return_object() { return task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            /// A task starts in the phase it was spawned for, not where it was called.
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            /// The scheduler destroys the coroutine once it has finished.
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+
+        task(task &&other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+        task &operator=(task &&other) noexcept {
+            if (this != &other) {
+                if (handle) {
+                    handle.destroy();
+                }
+                handle = std::exchange(other.handle, nullptr);
+            }
+            return *this;
+        }
+        task(const task &) = delete;
+        task &operator=(const task &) = delete;
+        /// Destroys a task that was never spawned.
+        ~task() {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        /// Hands the coroutine over to the caller, which becomes responsible for destroying it.
+        [[nodiscard]] std::coroutine_handle<promise_type> release() { return std::exchange(handle, nullptr); }
+
+      private:
+        explicit task(std::coroutine_handle<promise_type> p_handle) : handle(p_handle) {}
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    /// Owns the suspended tasks of a world and resumes them from the "Resume Tasks" systems. Tasks wait for a phase, or for a parallel_for()
+    /// running as low priority WorkerThreadPool tasks inside the engine (on the Flecs task threads outside of it).
+    class TaskScheduler {
+      public:
+        TaskScheduler() = default;
+        TaskScheduler(const TaskScheduler &) = delete;
+        TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+        ~TaskScheduler() {
+            for (std::unique_ptr<ParallelJob> &job : parallel_jobs) {
+                job->join();
+                job->handle.destroy();
+            }
+            for (auto &[phase, handles] : waiting) {
+                for (std::coroutine_handle<> handle : handles) {
+                    handle.destroy();
+                }
+            }
+        }
+
+        /// Resumes `handle` the next time the "Resume Tasks" system of `phase` runs. Phases without one resume the task in
+        /// next_frame_phase instead.
+        void schedule(flecs::entity_t phase, std::coroutine_handle<> handle) {
+            if (!resume_phases.contains(phase)) {
+                ecs_warn("stagehand: tasks can't wait for phase #%llu, which has no Resume Tasks system; resuming next frame",
+                         static_cast<unsigned long long>(phase));
+                phase = next_frame_phase;
+            }
+            waiting[phase].push_back(handle);
+        }
+
+        /// Takes ownership of a task and starts it the next time `phase` runs.
+        void spawn(task new_task, flecs::entity_t phase) {
+            std::coroutine_handle<task::promise_type> handle = new_task.release();
+            if (!handle) {
+                return;
+            }
+            handle.promise().scheduler = this;
+            ++task_count;
+            schedule(phase, handle);
+        }
+
+        /// Runs `body(i)` for every i in [0, count) on the task threads and resumes `handle` in the first Resume Tasks system that runs
+        /// after they all have finished. Inside the engine the chunks run as low priority WorkerThreadPool tasks, which never take the
+        /// threads the Flecs workers claimed, so chunks still running in a later frame don't hold it up. Outside of it they run as Flecs
+        /// tasks; returns false if the world has no task threads, in which case the body ran on the calling thread.
+        bool start_parallel_job(int32_t count, std::function<void(int32_t)> body, int32_t worker_count, std::coroutine_handle<> handle) {
+            // Low priority tasks take the job off the calling thread even as a single chunk, and as many chunks as they have threads.
+            const bool low_priority_tasks = ::utilities::WorkerThreadPoolTasks::is_installed();
+            if (low_priority_tasks) {
+                worker_count = ::utilities::WorkerThreadPoolTasks::get_capacity() - ::utilities::WorkerThreadPoolTasks::get_high_priority_capacity();
+            } else if (!ecs_os_has_task_support() || worker_count <= 1) {
+                for (int32_t i = 0; i < count; ++i) {
+                    body(i);
+                }
+                return false;
+            }
+
+            std::unique_ptr<ParallelJob> job = std::make_unique<ParallelJob>();
+            job->body = std::move(body);
+            job->handle = handle;
+            const int32_t chunk_count = std::clamp(worker_count, 1, count);
+            job->remaining.store(chunk_count, std::memory_order_relaxed);
+            job->chunks.resize(static_cast<size_t>(chunk_count));
+            for (int32_t chunk = 0; chunk < chunk_count; ++chunk) {
+                job->chunks[static_cast<size_t>(chunk)] = {job.get(), static_cast<int32_t>(int64_t{count} * chunk / chunk_count),
+                                                            static_cast<int32_t>(int64_t{count} * (chunk + 1) / chunk_count)};
+            }
+            for (ParallelJob::Chunk &chunk : job->chunks) {
+                const int64_t pool_task = ::utilities::WorkerThreadPoolTasks::add_low_priority_task(&ParallelJob::run_chunk, &chunk);
+                if (pool_task >= 0) {
+                    job->pool_tasks.push_back(pool_task);
+                } else {
+                    job->threads.push_back(ecs_os_task_new(&ParallelJob::run_chunk, &chunk));
+                }
+            }
+            parallel_jobs.push_back(std::move(job));
+            return true;
+        }
+
+        /// Called by the Resume Tasks system of `phase`. Tasks that wait for the same phase again are resumed the next time it runs.
+        void resume(flecs::entity_t phase) {
+            std::vector<std::coroutine_handle<>> ready;
+            for (size_t i = 0; i < parallel_jobs.size();) {
+                if (parallel_jobs[i]->remaining.load(std::memory_order_acquire) == 0) {
+                    parallel_jobs[i]->join();
+                    ready.push_back(parallel_jobs[i]->handle);
+                    parallel_jobs[i] = std::move(parallel_jobs.back());
+                    parallel_jobs.pop_back();
+                } else {
+                    ++i;
+                }
+            }
+
+            auto phase_waiting = waiting.find(phase);
+            if (phase_waiting != waiting.end()) {
+                ready.insert(ready.end(), phase_waiting->second.begin(), phase_waiting->second.end());
+                phase_waiting->second.clear();
+            }
+
+            for (std::coroutine_handle<> handle : ready) {
+                handle.resume();
+                if (handle.done()) {
+                    handle.destroy();
+                    --task_count;
+                }
+            }
+        }
+
+        /// Called when a Resume Tasks system is registered for `phase`.
+        void add_resume_phase(flecs::entity_t phase) { resume_phases.insert(phase); }
+
+        /// Tasks spawned and not finished yet.
+        [[nodiscard]] int64_t get_task_count() const { return task_count; }
+
+        /// The phase next_frame() resumes tasks in: the first phase with a Resume Tasks system.
+        flecs::entity_t next_frame_phase = flecs::OnLoad;
+
+      private:
+        struct ParallelJob {
+            struct Chunk {
+                ParallelJob *job = nullptr;
+                int32_t begin = 0;
+                int32_t end = 0;
+            };
+
+            static void *run_chunk(void *param) {
+                const Chunk *chunk = static_cast<const Chunk *>(param);
+                for (int32_t i = chunk->begin; i < chunk->end; ++i) {
+                    chunk->job->body(i);
+                }
+                chunk->job->remaining.fetch_sub(1, std::memory_order_release);
+                return nullptr;
+            }
+
+            void join() {
+                for (ecs_os_thread_t thread : threads) {
+                    ecs_os_task_join(thread);
+                }
+                threads.clear();
+                for (int64_t pool_task : pool_tasks) {
+                    ::utilities::WorkerThreadPoolTasks::wait_for_task(pool_task);
+                }
+                pool_tasks.clear();
+            }
+
+            std::function<void(int32_t)> body;
+            std::coroutine_handle<> handle;
+            std::atomic<int32_t> remaining = 0;
+            std::vector<Chunk> chunks;
+            std::vector<ecs_os_thread_t> threads;
+            std::vector<int64_t> pool_tasks;
+        };
+
+        std::unordered_map<flecs::entity_t, std::vector<std::coroutine_handle<>>> waiting;
+        std::unordered_set<flecs::entity_t> resume_phases;
+        std::vector<std::unique_ptr<ParallelJob>> parallel_jobs;
+        int64_t task_count = 0;
+    };
+
+    /// Singleton holding the world's TaskScheduler. Tasks keep a pointer to the scheduler, so it lives on the heap rather than in the
+    /// component storage.
+    struct TaskSchedulerSingleton {
+        std::shared_ptr<TaskScheduler> scheduler = std::make_shared<TaskScheduler>();
+    };
+
+    /// Suspends the task until the next frame.
+    struct NextFrameAwaiter {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<task::promise_type> handle) const {
+            TaskScheduler *scheduler = handle.promise().scheduler;
+            scheduler->schedule(scheduler->next_frame_phase, handle);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    /// Suspends the task until `phase` runs: later in this frame if the pipeline hasn't reached it yet, otherwise in the next frame.
+    struct PhaseAwaiter {
+        flecs::entity_t phase = 0;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<task::promise_type> handle) const { handle.promise().scheduler->schedule(phase, handle); }
+        void await_resume() const noexcept {}
+    };
+
+    /// Splits a loop across the task threads. The task resumes once every iteration has run.
+    struct ParallelForAwaiter {
+        int32_t count = 0;
+        std::function<void(int32_t)> body;
+        int32_t worker_count = 1;
+
+        bool await_ready() const noexcept { return count <= 0; }
+        bool await_suspend(std::coroutine_handle<task::promise_type> handle) {
+            return handle.promise().scheduler->start_parallel_job(count, std::move(body), worker_count, handle);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    [[nodiscard]] inline NextFrameAwaiter next_frame() { return {}; }
+
+    [[nodiscard]] inline PhaseAwaiter phase(flecs::entity_t phase) { return {phase}; }
+
+    /// `body(i)` is called for every i in [0, count), concurrently, so it must only touch data the iterations don't share, and not the world.
+    /// Inside the engine the loop is split into as many parts as the WorkerThreadPool has threads for low priority tasks. Outside of it,
+    /// into as many parts as `world` has threads (see FlecsWorld.max_parallelism); a world without threads runs it in place.
+    [[nodiscard]] inline ParallelForAwaiter parallel_for(const flecs::world &world, int32_t count, std::function<void(int32_t)> body) {
+        return {count, std::move(body), ecs_get_stage_count(world)};
+    }
+
+    /// Starts `new_task` the next time `phase` runs. The world owns the task from then on and destroys it when it finishes, or with the world.
+    inline void spawn_task(flecs::world &world, task new_task, flecs::entity_t phase = flecs::OnUpdate) {
+        world.get<TaskSchedulerSingleton>().scheduler->spawn(std::move(new_task), phase);
+    }
+
+    /// Returns the number of tasks spawned in `world` that haven't finished yet.
+    [[nodiscard]] inline int64_t get_task_count(const flecs::world &world) {
+        const TaskSchedulerSingleton *singleton = world.try_get<TaskSchedulerSingleton>();
+        return singleton ? singleton->scheduler->get_task_count() : 0;
+    }
+
+    REGISTER([](flecs::world &world) {
+        world.component<TaskSchedulerSingleton>("stagehand::TaskSchedulerSingleton").add(flecs::Singleton);
+        world.set<TaskSchedulerSingleton>({});
+    });
+} // namespace stagehand
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flecs.h"
+
+#include "stagehand/registry.h"
+
+namespace stagehand {
+    /// Set on a system registered with register_staggered_system(): every run processes one of `slices` equal parts of each matched table,
+    /// so each entity is visited once every `slices` runs. 1 processes every entity on every run.
+    struct Stagger {
+        int32_t slices = 1;
+        /// The part the next run processes.
+        int32_t next_slice = 0;
+    };
+
+    /// Limits `system` to `rate` runs per second of simulated time, using a Flecs interval timer. 0 runs it every frame again.
+    inline void set_system_update_rate(flecs::world &world, flecs::entity_t system, double rate) {
+        ecs_set_interval(world, system, rate > 0.0 ? static_cast<ecs_ftime_t>(1.0 / rate) : 0);
+    }
+
+    /// Returns the runs per second `system` is limited to, or 0 if it runs every frame.
+    [[nodiscard]] inline double get_system_update_rate(const flecs::world &world, flecs::entity_t system) {
+        const ecs_ftime_t interval = ecs_get_interval(world, system);
+        return interval > 0 ? 1.0 / static_cast<double>(interval) : 0.0;
+    }
+
+    /// Splits the entities of a staggered system across `slices` runs. Has no effect on other systems.
+    inline void set_system_stagger(flecs::world &world, flecs::entity_t system, int32_t slices) {
+        Stagger *stagger = world.entity(system).try_get_mut<Stagger>();
+        if (stagger == nullptr) {
+            return;
+        }
+        stagger->slices = slices > 1 ? slices : 1;
+        stagger->next_slice = 0;
+    }
+
+    /// Returns how many runs a staggered system spreads its entities across, or 0 if `system` isn't staggered.
+    [[nodiscard]] inline int32_t get_system_stagger(const flecs::world &world, flecs::entity_t system) {
+        const Stagger *stagger = world.entity(system).try_get<Stagger>();
+        return stagger ? stagger->slices : 0;
+    }
+
+    REGISTER([](flecs::world &world) { world.component<Stagger>("stagehand::Stagger"); });
+} // namespace stagehand
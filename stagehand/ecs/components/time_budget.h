@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flecs.h"
+
+#include "stagehand/registry.h"
+
+namespace stagehand {
+    /// Set on a pipeline phase to cap how long the time-sliced systems in it (see register_time_sliced_system()) may run per frame.
+    /// The budget is shared: the first time-sliced system of the phase may use all of it, and the ones after it get what is left.
+    /// Phases without a budget don't limit their time-sliced systems, which then process all of their entities every frame.
+    /// A frame is a world.progress(), which is one fixed tick in PROGRESS_TICK_FIXED mode, so there the budget is per tick.
+    struct PhaseTimeBudget {
+        double budget_milliseconds = 0.0;
+        /// Time the phase's time-sliced systems have used in `frame`.
+        double used_milliseconds = 0.0;
+        /// The world frame (WorldInfo::frame_count_total) `used_milliseconds` was measured in.
+        int64_t frame = -1;
+    };
+
+    /// Set on a system registered with register_time_sliced_system(): where its iteration stopped when the budget ran out, and how far it
+    /// has got. A pass is one full iteration over the system's entities, spread over as many frames as the budget requires.
+    struct TimeSlicedCursor {
+        /// The table to resume in, or nullptr to start a new pass. Compared by address only, never dereferenced.
+        const ecs_table_t *table = nullptr;
+        /// The first table row not processed yet.
+        int32_t row = 0;
+        /// Entities processed in the last frame the system ran.
+        int32_t processed_entities = 0;
+        int64_t completed_passes = 0;
+    };
+
+    /// Sets the time budget of `phase`, in milliseconds. 0 removes it.
+    inline void set_phase_time_budget(flecs::world &world, flecs::entity_t phase, double budget_milliseconds) {
+        flecs::entity phase_entity = world.entity(phase);
+        if (budget_milliseconds > 0.0) {
+            phase_entity.ensure<PhaseTimeBudget>().budget_milliseconds = budget_milliseconds;
+            phase_entity.modified<PhaseTimeBudget>();
+        } else {
+            phase_entity.remove<PhaseTimeBudget>();
+        }
+    }
+
+    /// Returns the time budget of `phase`, in milliseconds, or 0 if it has none.
+    [[nodiscard]] inline double get_phase_time_budget(const flecs::world &world, flecs::entity_t phase) {
+        const PhaseTimeBudget *budget = world.entity(phase).try_get<PhaseTimeBudget>();
+        return budget ? budget->budget_milliseconds : 0.0;
+    }
+
+    REGISTER([](flecs::world &world) {
+        world.component<PhaseTimeBudget>("stagehand::PhaseTimeBudget");
+        world.component<TimeSlicedCursor>("stagehand::TimeSlicedCursor");
+    });
+} // namespace stagehand
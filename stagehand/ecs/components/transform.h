@@ -1,7 +1,12 @@
 #pragma once
 
+#include <array>
+
+#include "flecs.h"
+
 #include "stagehand/ecs/components/godot_variants.h"
 #include "stagehand/ecs/components/macros.h"
+#include "stagehand/registry.h"
 
 namespace stagehand::transform {
 
@@ -15,4 +20,26 @@ namespace stagehand::transform {
     GODOT_VARIANT(Scale3D, godot::Vector3, {1.0, 1.0, 1.0});
     GODOT_VARIANT(Transform3D, godot::Transform3D);
 
+    /// Transform2D in the float layout of a MultiMesh instance (see multimesh_packing.h). The transform compose system keeps it up to date on
+    /// entities that have it, and MultiMesh renderers copy it into their buffer as is, a table at a time, instead of converting every
+    /// transform each frame. Opt in per entity or prefab:
+    ///   world.prefab("Bullet").is_a(world.lookup(stagehand::names::prefabs::ENTITY_2D)).add<stagehand::transform::RenderTransform2D>();
+    struct RenderTransform2D {
+        std::array<float, 8> data = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+    };
+
+    /// Transform3D in the float layout of a MultiMesh instance. See RenderTransform2D.
+    struct RenderTransform3D {
+        std::array<float, 12> data = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    };
+
+    static_assert(sizeof(RenderTransform2D) == 8 * sizeof(float) && sizeof(RenderTransform3D) == 12 * sizeof(float),
+                  "Render transforms are copied into MultiMesh buffers as is, so they can't have padding");
+
+    REGISTER([](flecs::world &world) {
+        // Instances get their own copy when the component is added to a prefab, since the compose system writes it per entity.
+        world.component<RenderTransform2D>("stagehand::transform::RenderTransform2D").add(flecs::OnInstantiate, flecs::Override);
+        world.component<RenderTransform3D>("stagehand::transform::RenderTransform3D").add(flecs::OnInstantiate, flecs::Override);
+    });
+
 } // namespace stagehand::transform
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/macros.h"
+#include "stagehand/registry.h"
+#include "stagehand/utilities/per_stage_queue.h"
+
+namespace stagehand {
+    /// Receives typed events that are forwarded to Godot. Implemented by the host that drains the event buffers (FlecsWorld).
+    class TypedEventSink {
+      public:
+        virtual ~TypedEventSink() = default;
+        /// Returns true if events of this type should be converted to a Dictionary and delivered, i.e. a Godot listener exists for them.
+        [[nodiscard]] virtual bool wants(size_t event_type_index) const = 0;
+        virtual void deliver(size_t event_type_index, const godot::Dictionary &data, flecs::entity_t source_entity_id) = 0;
+    };
+
+    /// Describes one event type declared with EVENT().
+    struct TypedEventType {
+        const char *name;
+        void (*drain)(flecs::world &world, size_t event_type_index, TypedEventSink *sink);
+        void (*prepare)(flecs::world &world);
+    };
+
+    namespace internal {
+        constexpr bool stagehand_is_typed_event(...) { return false; }
+
+        template <typename T>
+        concept typed_event = stagehand_is_typed_event(static_cast<T *>(nullptr));
+
+        /// All event types declared with EVENT() in this process, in declaration order.
+        inline std::vector<TypedEventType> &get_typed_event_types() {
+            static std::vector<TypedEventType> types;
+            return types;
+        }
+
+        /// Per-type event buffer, stored as a singleton on the world, with one lane per stage so multi-threaded systems can emit.
+        /// Buffers are cleared rather than freed after delivery, so once they have grown to the peak number of events per frame, emitting and
+        /// delivering events doesn't allocate.
+        template <typename T> struct EventBuffer {
+            struct Entry {
+                T event;
+                flecs::entity_t source_entity_id = 0;
+            };
+            /// Events emitted since the last drain.
+            PerStageQueue<Entry> entries;
+            /// Lane being delivered. Listeners may emit new events while it is delivered; those land in `entries`.
+            std::vector<Entry> delivering;
+        };
+
+        template <typename T> EventBuffer<T> *get_event_buffer(const flecs::world &world) {
+            // Go through the real world so this also works from inside systems, where `world` is a stage.
+            return world.get_world().try_get_mut<EventBuffer<T>>();
+        }
+
+        template <typename T> void drain_event_buffer(flecs::world &world, size_t event_type_index, TypedEventSink *sink) {
+            EventBuffer<T> *buffer = world.try_get_mut<EventBuffer<T>>();
+            if (buffer == nullptr || buffer->entries.empty()) {
+                return;
+            }
+
+            const bool deliver = sink != nullptr && sink->wants(event_type_index);
+            buffer->entries.drain(buffer->delivering, [&](const typename EventBuffer<T>::Entry &entry) {
+                if (deliver) {
+                    sink->deliver(event_type_index, struct_to_dictionary(entry.event), entry.source_entity_id);
+                }
+            });
+        }
+
+        template <typename T> void prepare_event_buffer(flecs::world &world) {
+            EventBuffer<T> *buffer = world.try_get_mut<EventBuffer<T>>();
+            if (buffer != nullptr) {
+                buffer->entries.prepare(world);
+            }
+        }
+    } // namespace internal
+
+    /// Registers an event type declared with EVENT(): its members for the Flecs explorer, and the world-owned buffer events are queued in.
+    template <typename T> class EventRegistrar {
+      public:
+        explicit EventRegistrar(const char *name) {
+            internal::get_typed_event_types().push_back({name, &internal::drain_event_buffer<T>, &internal::prepare_event_buffer<T>});
+            register_callback([](flecs::world &world) {
+                internal::register_pfr_members<T>(world);
+                world.component<internal::EventBuffer<T>>().add(flecs::Singleton);
+                world.add<internal::EventBuffer<T>>();
+                internal::prepare_event_buffer<T>(world);
+            });
+        }
+    };
+
+    /// Queues a typed event. It is visible to for_each_event() for the rest of the frame, and is converted into a Dictionary for Godot
+    /// (see FlecsWorld::connect_event and stagehand_signal_emitted) only if something on the Godot side listens for it.
+    /// Safe to call from multi-threaded systems: each stage queues into its own lane. Inside a system, pass it.world() (or an entity or
+    /// iterator from it) so the event lands in the lane of the stage the system runs on.
+    template <internal::typed_event T> void emit_event(const flecs::world &world, const T &event, flecs::entity_t source_entity_id = 0) {
+        internal::EventBuffer<T> *buffer = internal::get_event_buffer<T>(world);
+        if (unlikely(buffer == nullptr)) {
+            return;
+        }
+        std::vector<typename internal::EventBuffer<T>::Entry> *lane = buffer->entries.lane(world);
+        if (unlikely(lane == nullptr)) {
+            // Only when the number of threads was changed on the flecs::world directly, outside of FlecsWorld, mid-frame.
+            godot::UtilityFunctions::push_warning("stagehand::emit_event: no event lane for this stage, the event was dropped");
+            return;
+        }
+        lane->push_back({event, source_entity_id});
+    }
+
+    /// Queues a typed event with an entity as its source.
+    template <internal::typed_event T> void emit_event(const flecs::entity &source_entity, const T &event) {
+        emit_event(source_entity.world(), event, source_entity.id());
+    }
+
+    /// Queues a typed event with the entity at an iterator row as its source.
+    template <internal::typed_event T> void emit_event(const flecs::iter &it, const size_t index, const T &event) { emit_event(it.entity(index), event); }
+
+    /// Calls callback(const T &event, flecs::entity_t source_entity_id) for every event of type T queued since the last drain.
+    /// Systems that run after the emitting system in the same frame see its events. Events are visited lane by lane (stage by stage), so
+    /// the order across emitting threads is not the emission order.
+    /// @note Don't read events in a system that runs concurrently with a system emitting the same type.
+    template <internal::typed_event T, typename Callback> void for_each_event(const flecs::world &world, Callback &&callback) {
+        const internal::EventBuffer<T> *buffer = internal::get_event_buffer<T>(world);
+        if (buffer == nullptr) {
+            return;
+        }
+        buffer->entries.for_each([&](const typename internal::EventBuffer<T>::Entry &entry) { callback(entry.event, entry.source_entity_id); });
+    }
+
+    /// Delivers every queued typed event to `sink` (if it wants them) and clears the buffers.
+    /// FlecsWorld calls this after each progress(); code that drives a flecs::world directly should call it once per frame with no sink.
+    inline void drain_typed_events(flecs::world &world, TypedEventSink *sink = nullptr) {
+        const std::vector<TypedEventType> &types = internal::get_typed_event_types();
+        for (size_t event_type_index = 0; event_type_index < types.size(); ++event_type_index) {
+            types[event_type_index].drain(world, event_type_index, sink);
+        }
+    }
+
+    /// Gives every typed event buffer a lane per stage. Runs in PreFrame (see stagehand/ecs/systems/event_queues.h), so changing the
+    /// number of threads between frames is picked up before any system emits.
+    inline void prepare_typed_events(flecs::world &world) {
+        for (const TypedEventType &type : internal::get_typed_event_types()) {
+            type.prepare(world);
+        }
+    }
+} // namespace stagehand
+
+/// Macro that defines a typed event: a PFR-reflectable aggregate that is queued in a world-owned buffer instead of being packed into a
+/// Dictionary. C++ systems read it with stagehand::for_each_event(); Godot receives it as a Dictionary named after the struct, only
+/// when a listener exists.
+///
+/// Example:
+///   EVENT(EnemyDied, {
+///       godot::Vector2 position;
+///       uint8_t type = 0;
+///   });
+///   stagehand::emit_event(it, row, EnemyDied{positions[row], type});
+#define EVENT(Name, ...)                                                                                                                                       \
+    struct Name __VA_ARGS__;                                                                                                                                   \
+    constexpr bool stagehand_is_typed_event(Name *) { return true; }                                                                                           \
+    inline auto register_##Name##_event = stagehand::EventRegistrar<Name>(#Name)
@@ -10,6 +10,29 @@ namespace stagehand {
     inline flecs::entity OnRender;
     inline flecs::entity PostRender;
 
+    /// Tag on the phases that present the simulated state: OnRender and PostRender (and any phase that depends on them).
+    struct PresentationPhase {};
+    /// Tag on flecs::OnUpdate, so pipelines can tell the phases before it from the ones that run from it on.
+    struct UpdatePhase {};
+    /// Tag on systems that call Godot servers and so have to run on the main thread. In PROGRESS_TICK_ASYNC mode they run before the
+    /// simulation thread starts (phases before OnUpdate) or after it has been joined (OnUpdate and later) instead of on the simulation thread.
+    /// The main thread can't step in halfway through the asynchronous step, so this moves the later ones behind every other simulation
+    /// system, PreRender included: they see the state the whole step left, and what they write is picked up by the next step. Change tags
+    /// are only reset in PostRender, so they still see every change of the step.
+    struct MainThreadSystem {};
+
+    /// Pipeline with every phase except the presentation phases. Used in PROGRESS_TICK_FIXED mode, where it runs once per fixed tick.
+    inline flecs::entity SimulationPipeline;
+    /// Pipeline with only the presentation phases. Used in PROGRESS_TICK_FIXED mode, where it runs once per displayed frame.
+    inline flecs::entity PresentationPipeline;
+    /// SimulationPipeline without the MainThreadSystem systems. Used in PROGRESS_TICK_ASYNC mode, where it runs on the simulation thread.
+    inline flecs::entity AsyncSimulationPipeline;
+    /// The MainThreadSystem systems in the simulation phases before OnUpdate. Run on the main thread before each asynchronous simulation step.
+    inline flecs::entity MainThreadPreUpdatePipeline;
+    /// The MainThreadSystem systems in OnUpdate and the later simulation phases. Run on the main thread after each asynchronous simulation step,
+    /// so after every AsyncSimulationPipeline system, whatever their phases.
+    inline flecs::entity MainThreadPostUpdatePipeline;
+
     REGISTER([](flecs::world &world) {
         OnEarlyUpdate = world.entity(stagehand::names::phases::ON_EARLY_UPDATE).add(flecs::Phase).depends_on(flecs::PreUpdate);
         world.entity(flecs::OnUpdate).depends_on(OnEarlyUpdate);
@@ -17,5 +40,61 @@ namespace stagehand {
         PreRender = world.entity(stagehand::names::phases::PRE_RENDER).add(flecs::Phase).depends_on(flecs::OnStore);
         OnRender = world.entity(stagehand::names::phases::ON_RENDER).add(flecs::Phase).depends_on(PreRender);
         PostRender = world.entity(stagehand::names::phases::POST_RENDER).add(flecs::Phase).depends_on(OnRender);
+
+        // PreRender belongs to the simulation: Transform Compose has to run every tick so interpolation snapshots see the composed transform.
+        world.component<PresentationPhase>(stagehand::names::phases::PRESENTATION_PHASE);
+        OnRender.add<PresentationPhase>();
+        PostRender.add<PresentationPhase>();
+        world.component<UpdatePhase>(stagehand::names::phases::UPDATE_PHASE);
+        world.entity(flecs::OnUpdate).add<UpdatePhase>();
+        world.component<MainThreadSystem>(stagehand::names::pipelines::MAIN_THREAD_SYSTEM);
+
+        // Same terms as the builtin pipeline, split on whether the phase (or a phase it depends on) is a presentation phase.
+        // clang-format off
+        SimulationPipeline = world.pipeline(stagehand::names::pipelines::SIMULATION)
+            .with(flecs::System)
+            .with(flecs::Phase).cascade(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::ChildOf)
+            .without<PresentationPhase>().up(flecs::DependsOn)
+            .build();
+
+        PresentationPipeline = world.pipeline(stagehand::names::pipelines::PRESENTATION)
+            .with(flecs::System)
+            .with(flecs::Phase).cascade(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::ChildOf)
+            .with<PresentationPhase>().up(flecs::DependsOn)
+            .build();
+
+        AsyncSimulationPipeline = world.pipeline(stagehand::names::pipelines::ASYNC_SIMULATION)
+            .with(flecs::System)
+            .with(flecs::Phase).cascade(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::ChildOf)
+            .without<PresentationPhase>().up(flecs::DependsOn)
+            .without<MainThreadSystem>()
+            .build();
+
+        MainThreadPreUpdatePipeline = world.pipeline(stagehand::names::pipelines::MAIN_THREAD_PRE_UPDATE)
+            .with(flecs::System)
+            .with(flecs::Phase).cascade(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::ChildOf)
+            .without<PresentationPhase>().up(flecs::DependsOn)
+            .with<MainThreadSystem>()
+            .without<UpdatePhase>().up(flecs::DependsOn)
+            .build();
+
+        MainThreadPostUpdatePipeline = world.pipeline(stagehand::names::pipelines::MAIN_THREAD_POST_UPDATE)
+            .with(flecs::System)
+            .with(flecs::Phase).cascade(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::DependsOn)
+            .without(flecs::Disabled).up(flecs::ChildOf)
+            .without<PresentationPhase>().up(flecs::DependsOn)
+            .with<MainThreadSystem>()
+            .with<UpdatePhase>().up(flecs::DependsOn)
+            .build();
+        // clang-format on
     });
 } // namespace stagehand
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <flecs.h>
+
+#include "stagehand/ecs/components/event_payload.h"
+#include "stagehand/ecs/components/typed_event.h"
+#include "stagehand/ecs/pipeline_phases.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+
+namespace stagehand {
+    /// Gives the signal queue and every typed event buffer a lane per stage of `world`. Call from the main thread while no system is
+    /// running, right after the number of stages changed.
+    inline void prepare_event_queues(flecs::world &world) {
+        SignalQueue *signal_queue = world.try_get_mut<SignalQueue>();
+        if (signal_queue != nullptr) {
+            signal_queue->payloads.prepare(world);
+        }
+        prepare_typed_events(world);
+    }
+
+    REGISTER([](flecs::world &world) {
+        // The number of stages can only change between frames, so preparing the queues here means emitters always find the lane of the
+        // stage they run on. FlecsWorld also prepares them when it changes the number of threads, since run_pipeline() skips PreFrame.
+        world.system(names::systems::EVENT_QUEUES_PREPARE)
+            .kind(flecs::PreFrame)
+            .run([](flecs::iter &it) {
+                flecs::world world = it.world();
+                prepare_event_queues(world);
+            });
+
+        // Emits the payloads queued by emit_signal() as Flecs events. Runs on the main thread after OnRender, outside of readonly mode, so
+        // observers (and the Godot handlers they call) can change the world directly.
+        world.system(names::systems::EVENT_QUEUES_EMIT_SIGNALS)
+            .kind(PostRender)
+            .immediate()
+            .run([](flecs::iter &it) {
+                flecs::world world = it.world();
+                SignalQueue *signal_queue = world.try_get_mut<SignalQueue>();
+                if (signal_queue == nullptr || signal_queue->payloads.empty()) {
+                    return;
+                }
+
+                const flecs::entity_t no_source_emitter = signal_queue->no_source_emitter;
+                signal_queue->payloads.drain(signal_queue->draining, [&world, no_source_emitter](EventPayload &payload) {
+                    // The source may have been deleted since the payload was queued; the id is still passed on in the payload.
+                    flecs::entity_t emitter_entity_id = static_cast<flecs::entity_t>(payload.source_entity_id);
+                    if (emitter_entity_id == 0 || !world.is_alive(emitter_entity_id)) {
+                        emitter_entity_id = no_source_emitter;
+                    }
+                    world.event<EventPayload>().id(flecs::Any).entity(emitter_entity_id).ctx(payload).emit();
+                });
+            });
+    });
+} // namespace stagehand
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <godot_cpp/variant/transform2d.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/interpolation.h"
+#include "stagehand/ecs/components/transform.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+
+namespace stagehand::interpolation {
+    constexpr const char *SNAPSHOT_SYSTEM_NAMES[] = {
+        names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_2D,
+        names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_3D,
+        names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_2D,
+        names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_3D,
+    };
+
+    // Copies the transform into Previous<TransformType> at the start of every tick, before any system moves the entity.
+    template <typename TransformType> void register_snapshot_system(flecs::world &world, const char *name) {
+        world.system<Previous<TransformType>, const TransformType>(name)
+            .kind(flecs::PreFrame)
+            .multi_threaded()
+            .each([](Previous<TransformType> &previous, const TransformType &current) {
+                previous.value = current;
+                previous.is_set = true;
+            })
+            .disable();
+    }
+
+    /// Enables or disables the snapshot systems. They start disabled, since only PROGRESS_TICK_FIXED mode interpolates.
+    inline void set_snapshots_enabled(flecs::world &world, bool enabled) {
+        for (const char *name : SNAPSHOT_SYSTEM_NAMES) {
+            flecs::entity system = world.lookup(name);
+            if (!system.is_valid()) {
+                continue;
+            }
+            if (enabled) {
+                system.enable();
+            } else {
+                system.disable();
+            }
+        }
+    }
+
+    REGISTER([](flecs::world &world) {
+        register_snapshot_system<godot::Transform2D>(world, names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_2D);
+        register_snapshot_system<godot::Transform3D>(world, names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_3D);
+        register_snapshot_system<transform::Transform2D>(world, names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_2D);
+        register_snapshot_system<transform::Transform3D>(world, names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_3D);
+    });
+} // namespace stagehand::interpolation
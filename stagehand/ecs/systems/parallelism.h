@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/parallelism.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+
+namespace stagehand {
+    /// Registers a system that runs multi-threaded only when it has enough work: once as `name`, multi-threaded, and once as
+    /// "`name` (Single-Threaded)", a twin with the same terms and callback that isn't split across workers. Only one of the two is enabled at
+    /// a time; see ParallelismPolicy. To turn the system off, disable the variant that is enabled (or both): the policy doesn't switch a
+    /// system whose enabled variant was disabled, and once it is enabled again keeps the other one disabled.
+    /// @param configure Called with each variant's builder; sets the phase and any extra terms, and returns the builder.
+    /// @param callback Called with the iterator of every batch of matched entities, i.e. the body of a `while (it.next())` loop.
+    /// @returns The multi-threaded variant, which carries the ParallelismPolicy.
+    template <typename... Components, typename Configure, typename Callback>
+    flecs::system register_adaptive_system(flecs::world &world, const char *name, int32_t min_entities, Configure &&configure, Callback &&callback) {
+        std::shared_ptr<ParallelismCounter> counter = std::make_shared<ParallelismCounter>();
+        auto run = [counter, callback = std::forward<Callback>(callback)](flecs::iter &it) {
+            int32_t processed_entities = 0;
+            while (it.next()) {
+                processed_entities += static_cast<int32_t>(it.count());
+                callback(it);
+            }
+            counter->processed_entities.fetch_add(processed_entities, std::memory_order_relaxed);
+        };
+
+        flecs::system multi_threaded_system = configure(world.system<Components...>(name)).multi_threaded().run(run);
+        const std::string single_threaded_name = std::string(name) + " (Single-Threaded)";
+        flecs::system single_threaded_system = configure(world.system<Components...>(single_threaded_name.c_str())).run(run);
+        single_threaded_system.disable();
+
+        ParallelismPolicy policy;
+        policy.min_entities = min_entities;
+        policy.single_threaded_system = single_threaded_system.id();
+        policy.counter = std::move(counter);
+        multi_threaded_system.set<ParallelismPolicy>(std::move(policy));
+        return multi_threaded_system;
+    }
+
+    REGISTER([](flecs::world &world) {
+        // Picks the variant of every adaptive system from the work it did in the previous frame. Enabling and disabling systems is deferred
+        // to the end of PreFrame, before any of them runs.
+        world.system<ParallelismPolicy>(names::systems::PARALLELISM_UPDATE)
+            .kind(flecs::PreFrame)
+            .with(flecs::Disabled).optional() // The multi-threaded variant is disabled while the single-threaded one runs
+            .each([](flecs::entity multi_threaded_system, ParallelismPolicy &policy) {
+                policy.processed_entities = policy.counter->processed_entities.exchange(0, std::memory_order_relaxed);
+                flecs::entity single_threaded_system = multi_threaded_system.world().entity(policy.single_threaded_system);
+                flecs::entity active_system = policy.multi_threaded ? multi_threaded_system : single_threaded_system;
+                if (!active_system.enabled()) {
+                    policy.user_disabled = true;
+                    return;
+                }
+                if (policy.user_disabled) {
+                    // Re-enabled: the user may have enabled both variants.
+                    policy.user_disabled = false;
+                    (policy.multi_threaded ? single_threaded_system : multi_threaded_system).disable();
+                }
+
+                const int32_t threshold = policy.multi_threaded ? policy.min_entities / 2 : policy.min_entities;
+                const bool multi_threaded = policy.processed_entities >= threshold;
+                if (multi_threaded == policy.multi_threaded) {
+                    return;
+                }
+
+                policy.multi_threaded = multi_threaded;
+                ++policy.switches;
+                if (multi_threaded) {
+                    single_threaded_system.disable();
+                    multi_threaded_system.enable();
+                } else {
+                    multi_threaded_system.disable();
+                    single_threaded_system.enable();
+                }
+            });
+    });
+} // namespace stagehand
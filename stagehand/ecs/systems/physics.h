@@ -179,7 +179,8 @@ namespace stagehand::physics {
                         WriteState(server, rid_field[i], it.entity(i));
                     }
                 }
-            });
+            })
+                .template add<stagehand::MainThreadSystem>();
     }
 
     template <typename ServerT, typename ValueComponent, typename ChangedTag, auto BodyState, godot::Variant (*ToVariant)(const ValueComponent &)>
@@ -197,7 +198,8 @@ namespace stagehand::physics {
                     return;
                 }
                 server->body_set_state(rid, BodyState, ToVariant(value));
-            });
+            })
+                .template add<stagehand::MainThreadSystem>();
     }
 
     template <typename ServerT>
@@ -240,7 +242,8 @@ namespace stagehand::physics {
                     return;
                 }
                 write_transform_state<ServerT>(server, rid, position, rotation, scale);
-            });
+            })
+                .template add<stagehand::MainThreadSystem>();
     }
 
     template <typename ServerT> void register_sync_collision_system(flecs::world &world, const char *name) {
@@ -271,7 +274,8 @@ namespace stagehand::physics {
                 }
                 server->body_set_collision_layer(rid, layer);
                 server->body_set_collision_mask(rid, mask);
-            });
+            })
+                .template add<stagehand::MainThreadSystem>();
     }
 
     template <typename ServerT, typename SpaceTag> void free_owned_physics_space(flecs::world world) {
@@ -323,6 +327,8 @@ namespace stagehand::physics {
     }
 
     // --- Templated System Registration -----------------------------------
+    //
+    // Every system here calls into the physics server, so they are all tagged MainThreadSystem to stay off the PROGRESS_TICK_ASYNC thread.
 
     template <typename ServerT> void register_physics_systems(flecs::world &world) {
         using Traits = PhysicsDimensionTraits<ServerT>;
@@ -387,7 +393,8 @@ namespace stagehand::physics {
                     server->body_set_state(rid, Traits::BODY_STATE_TRANSFORM, transform);
 
                     e.add<PhysicsBodyInSpace>();
-                });
+                })
+                    .template add<stagehand::MainThreadSystem>();
         }
 
         // -- Physics Feedback (Transform) ---------------------------------
@@ -3,6 +3,7 @@
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include "stagehand/ecs/components/interpolation.h"
 #include "stagehand/ecs/components/rendering.h"
 #include "stagehand/ecs/components/transform.h"
 #include "stagehand/ecs/pipeline_phases.h"
@@ -162,6 +163,9 @@ namespace stagehand::rendering {
                     return;
                 }
 
+                const interpolation::InterpolationAlpha *alpha = it.world().try_get<interpolation::InterpolationAlpha>();
+                const float interpolation_alpha = alpha != nullptr ? alpha->value : 1.0f;
+
                 for (InstancedRendererConfig &renderer : renderers.instanced_renderers) {
                     const size_t lod_count = renderer.lod_configs.size();
                     if (lod_count == 0) {
@@ -264,6 +268,26 @@ namespace stagehand::rendering {
                         }
                     });
 
+                    // While interpolating, every interpolated entity needs a new transform each displayed frame, changed or not, so that it
+                    // also ends up exactly on its current transform once it stops moving.
+                    if (interpolation_alpha < 1.0f) {
+                        renderer.interpolation_query.run([&](flecs::iter &query_it) {
+                            while (query_it.next()) {
+                                auto transform_field = query_it.field<const stagehand::transform::Transform3D>(0);
+                                auto previous_field = query_it.field<const interpolation::Previous<stagehand::transform::Transform3D>>(1);
+                                for (auto i : query_it) {
+                                    const uint32_t slot_index = try_get_entity_slot(renderer, query_it.entity(i).id());
+                                    if (slot_index == InstancedRendererConfig::INVALID_SLOT) {
+                                        continue;
+                                    }
+
+                                    set_slot_transform(renderer, slot_index, interpolation::interpolate(previous_field[i], transform_field[i], interpolation_alpha),
+                                                       rendering_server);
+                                }
+                            }
+                        });
+                    }
+
                     for (const InstancedRendererConfig::UniformUpdateConfig &uniform_config : renderer.uniform_updates) {
                         uniform_config.query.run([&](flecs::iter &query_it) {
                             while (query_it.next()) {
@@ -1,60 +1,183 @@
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/classes/canvas_item.hpp>
 #include <godot_cpp/classes/multi_mesh.hpp>
+#include <godot_cpp/classes/node3d.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/core/object.hpp>
 #include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include "stagehand/ecs/components/interpolation.h"
 #include "stagehand/ecs/components/rendering.h"
+#include "stagehand/ecs/components/transform.h"
 #include "stagehand/ecs/pipeline_phases.h"
 #include "stagehand/names.h"
 #include "stagehand/nodes/multi_mesh_renderer.h"
 #include "stagehand/registry.h"
-
-// Buffer format: https://docs.godotengine.org/en/stable/classes/class_renderingserver.html#class-renderingserver-method-multimesh-set-buffer
-// The per - instance data size and expected data order is :
-// 2D :
-//     - Position : 8 floats(8 floats for Transform2D)
-//     - Position + Vertex color : 12 floats(8 floats for Transform2D, 4 floats for Color)
-//     - Position + Custom data : 12 floats(8 floats for Transform2D, 4 floats of custom data)
-//     - Position + Vertex color + Custom data : 16 floats(8 floats for Transform2D, 4 floats for Color, 4 floats of custom data)
-// 3D :
-//     - Position : 12 floats(12 floats for Transform3D)
-//     - Position + Vertex color : 16 floats(12 floats for Transform3D, 4 floats for Color)
-//     - Position + Custom data : 16 floats(12 floats for Transform3D, 4 floats of custom data)
-//     - Position + Vertex color + Custom data : 20 floats(12 floats for Transform3D, 4 floats for Color, 4 floats of custom data)
-//
-// Instance transforms are in row - major order.Specifically:
-// For Transform2D the float - order is : (x.x, y.x, padding_float, origin.x, x.y, y.y, padding_float, origin.y).
-// For Transform3D the float - order is : (basis.x.x, basis.y.x, basis.z.x, origin.x, basis.x.y, basis.y.y, basis.z.y, origin.y, basis.x.z, basis.y.z,
-// basis.z.z, origin.z).
+#include "stagehand/utilities/multimesh_packing.h"
 
 // Collect instances for a single prefab and update the corresponding multimesh buffer.
 // This helper builds a query specialized for the transform type (2D or 3D) and
 // conditionally includes vertex colors and custom data as query terms when the renderer expects them.
+// The first two query terms are the Godot transform and the RenderTransform2D/3D; tables without the former are copied from the latter.
+// They are followed by the optional Previous<TransformType>, then the optional transform component and its Previous, which render transforms
+// are composed from; when interpolating, the transform is blended from whichever pair the table has.
+// The buffer is filled in two passes: the first walks the query results and gives each one its range of instances, the second packs
+// those ranges, on the Flecs task threads when there are enough instances and free pool threads (see multimesh_packing.h for the buffer
+// format, and parallel_ranges.h for which threads the ranges get).
+// Renderers with incremental updates keep the buffer of the last frame and only re-pack the query results whose table changed. While the
+// layout of the buffer stays the same, a few changed instances are sent one by one, and a frame without changes sends nothing.
+// Culling renderers only pack the instances near the view of the active camera, so the buffer holds as many instances as are visible.
 
 namespace stagehand::rendering {
     inline flecs::system EntityRenderingMultiMesh;
 
-    template <typename TransformType> void update_renderer_for_prefab(godot::RenderingServer *rendering_server, const MultiMeshRendererConfig &renderer) {
-        uint32_t floats_per_instance = 0;
-        if (renderer.transform_format == godot::MultiMesh::TRANSFORM_2D) {
-            floats_per_instance = 8;
-        } else { // TRANSFORM_3D
-            floats_per_instance = 12;
+    /// Sends `count` packed instances to the MultiMesh one by one, starting at instance `first_instance`. The RenderingServer then only
+    /// uploads the regions of the MultiMesh that hold them, instead of the whole buffer.
+    template <typename TransformType>
+    void upload_multimesh_instances(godot::RenderingServer *rendering_server, const MultiMeshRendererConfig &renderer, const float *packed,
+                                    uint32_t first_instance, uint32_t count) {
+        constexpr uint32_t transform_floats = get_floats_per_instance<TransformType>(false, false);
+        const uint32_t floats_per_instance = get_floats_per_instance<TransformType>(renderer.use_colors, renderer.use_custom_data);
+        for (uint32_t i = 0; i < count; ++i) {
+            const float *data = packed + size_t{i} * floats_per_instance;
+            const int32_t index = static_cast<int32_t>(first_instance + i);
+            if constexpr (std::is_same_v<TransformType, Transform2D>) {
+                rendering_server->multimesh_instance_set_transform_2d(renderer.rid, index, Transform2D(data[0], data[4], data[1], data[5], data[3], data[7]));
+            } else {
+                const Transform3D transform(data[0], data[1], data[2], data[4], data[5], data[6], data[8], data[9], data[10], data[3], data[7], data[11]);
+                rendering_server->multimesh_instance_set_transform(renderer.rid, index, transform);
+            }
+            const float *extra = data + transform_floats;
+            if (renderer.use_colors) {
+                rendering_server->multimesh_instance_set_color(renderer.rid, index, Color(extra[0], extra[1], extra[2], extra[3]));
+                extra += 4;
+            }
+            if (renderer.use_custom_data) {
+                rendering_server->multimesh_instance_set_custom_data(renderer.rid, index, Color(extra[0], extra[1], extra[2], extra[3]));
+            }
         }
+    }
 
-        floats_per_instance += (renderer.use_colors ? 4 : 0) + (renderer.use_custom_data ? 4 : 0);
+    /// Gets what a culling renderer can see this frame, in its local space: the visible part of the canvas in 2D, which follows the active
+    /// Camera2D, and the frustum of the viewport's Camera3D in 3D. Returns false when there is nothing to cull against (the node is gone, or
+    /// there is no 3D camera), in which case every instance is drawn.
+    inline bool get_multimesh_cull_volume(const MultiMeshRendererConfig &renderer, MultiMeshCullVolume &volume) {
+        godot::Object *node = godot::ObjectDB::get_instance(renderer.node_id);
+        volume.margin = renderer.cull_margin;
+        if (const godot::CanvasItem *canvas_item = godot::Object::cast_to<godot::CanvasItem>(node)) {
+            const godot::Viewport *viewport = canvas_item->get_viewport();
+            if (viewport == nullptr) {
+                return false;
+            }
+            volume.rect = canvas_item->get_global_transform_with_canvas().affine_inverse().xform(viewport->get_visible_rect());
+            return true;
+        }
+        if (const godot::Node3D *node_3d = godot::Object::cast_to<godot::Node3D>(node)) {
+            const godot::Viewport *viewport = node_3d->get_viewport();
+            const godot::Camera3D *camera = viewport != nullptr ? viewport->get_camera_3d() : nullptr;
+            if (camera == nullptr) {
+                return false;
+            }
+            const godot::TypedArray<Plane> frustum = camera->get_frustum();
+            if (frustum.size() != static_cast<int64_t>(volume.planes.size())) {
+                return false;
+            }
+            const Transform3D to_local = node_3d->get_global_transform().affine_inverse();
+            for (size_t i = 0; i < volume.planes.size(); ++i) {
+                volume.planes[i] = to_local.xform(static_cast<Plane>(frustum[static_cast<int64_t>(i)]));
+            }
+            return true;
+        }
+        return false;
+    }
+
+    template <typename TransformType>
+    void update_renderer_for_prefab(godot::RenderingServer *rendering_server, MultiMeshRendererConfig &renderer, float interpolation_alpha,
+                                    int32_t worker_count, const MultiMeshCullVolume *cull_volume) {
+        const uint32_t floats_per_instance = get_floats_per_instance<TransformType>(renderer.use_colors, renderer.use_custom_data);
+
+        // First pass: one slice per query result, laid out back to back. Component columns don't move while the system runs, so the
+        // pointers stay valid after the iterator has moved on.
+        // With incremental updates, the slices whose table changed since the last frame (or that are blended from their previous
+        // transform) are also collected as dirty, back to back, along with where they are in the buffer. Only they need packing and
+        // uploading if the layout of the buffer hasn't changed.
+        thread_local std::vector<MultiMeshPackSlice<TransformType>> slices;
+        thread_local std::vector<MultiMeshPackSlice<TransformType>> dirty_slices;
+        thread_local std::vector<uint32_t> dirty_slice_instances;
+        slices.clear();
+        dirty_slices.clear();
+        dirty_slice_instances.clear();
+        uint32_t dirty_instance_count = 0;
+        uint32_t instance_count = 0;
+        const bool interpolating = interpolation_alpha < 1.0f;
+        using RenderTransformType = std::conditional_t<std::is_same_v<TransformType, Transform2D>, transform::RenderTransform2D, transform::RenderTransform3D>;
+        const int render_transform_field_index = 1;
+        const int color_field_index = 2;
+        const int custom_data_field_index = renderer.use_colors ? 3 : 2;
+        const int previous_field_index = 2 + (renderer.use_colors ? 1 : 0) + (renderer.use_custom_data ? 1 : 0);
+        const int component_transform_field_index = previous_field_index + 1;
+        const int previous_component_field_index = previous_field_index + 2;
 
-        uint32_t total_matches = 0;
         for (const auto &q : renderer.queries) {
-            total_matches += static_cast<uint32_t>(q.count());
+            q.run([&](flecs::iter &it) {
+                while (it.next()) {
+                    const uint32_t count = static_cast<uint32_t>(it.count());
+                    // Entities of the rendered prefabs that have neither transform have nothing to draw.
+                    if (count == 0 || (!it.is_set(0) && !it.is_set(render_transform_field_index))) {
+                        continue;
+                    }
+
+                    MultiMeshPackSlice<TransformType> &slice = slices.emplace_back();
+                    if (it.is_set(0)) {
+                        slice.transforms = &it.field<const TransformType>(0)[0];
+                        if (interpolating && it.is_set(previous_field_index)) {
+                            slice.previous_transforms = &it.field<const interpolation::Previous<TransformType>>(previous_field_index)[0];
+                        }
+                    } else {
+                        slice.render_transforms = it.field<const RenderTransformType>(render_transform_field_index)[0].data.data();
+                        if (interpolating && it.is_set(component_transform_field_index) && it.is_set(previous_component_field_index)) {
+                            using TransformComponent = TransformComponentFor<TransformType>;
+                            slice.component_transforms = &it.field<const TransformComponent>(component_transform_field_index)[0];
+                            slice.previous_component_transforms =
+                                &it.field<const interpolation::Previous<TransformComponent>>(previous_component_field_index)[0];
+                        }
+                    }
+                    if (renderer.use_colors) {
+                        slice.colors = &it.field<const Color>(color_field_index)[0];
+                    }
+                    if (renderer.use_custom_data) {
+                        slice.custom_data = &it.field<const CustomData>(custom_data_field_index)[0];
+                    }
+                    slice.first_instance = instance_count;
+                    slice.count = count;
+                    instance_count += count;
+
+                    const bool blended = slice.previous_transforms != nullptr || slice.previous_component_transforms != nullptr;
+                    if (renderer.incremental_updates && (it.changed() || blended)) {
+                        MultiMeshPackSlice<TransformType> &dirty_slice = dirty_slices.emplace_back(slice);
+                        dirty_slice.first_instance = dirty_instance_count;
+                        dirty_slice_instances.push_back(slice.first_instance);
+                        dirty_instance_count += count;
+                    }
+                }
+            });
         }
 
-        if (total_matches == 0 && renderer.instance_count == 0) {
+        if (instance_count == 0 && renderer.instance_count == 0) {
             rendering_server->multimesh_set_visible_instances(renderer.rid, 0);
+            renderer.uploaded_slices.clear();
             return;
         }
 
-        uint32_t instance_capacity_required = std::max(renderer.instance_count, total_matches);
+        uint32_t instance_capacity_required = std::max(renderer.instance_count, instance_count);
 
         // Use a growth strategy (next power of 2) to avoid frequent reallocations when the instance count fluctuates.
         uint32_t instance_capacity = 16;
@@ -67,6 +190,8 @@ namespace stagehand::rendering {
         uint32_t required_size = instance_capacity * floats_per_instance;
 
         if (buffer.size() < required_size || buffer.size() > (required_size * 2)) {
+            // Allocating clears the MultiMesh, so the next upload has to be a full one.
+            renderer.uploaded_slices.clear();
             godot::RenderingServer::MultimeshTransformFormat transform_format = renderer.transform_format == godot::MultiMesh::TRANSFORM_2D
                                                                                     ? godot::RenderingServer::MULTIMESH_TRANSFORM_2D
                                                                                     : godot::RenderingServer::MULTIMESH_TRANSFORM_3D;
@@ -81,79 +206,55 @@ namespace stagehand::rendering {
             buffer.resize(required_size);
         }
 
-        float *buffer_ptr = buffer.ptrw();
-        uint32_t instance_count = 0;
-
-        for (const auto &q : renderer.queries) {
-            q.run([&](flecs::iter &it) {
-                while (it.next()) {
-                    auto transform_field = it.field<const TransformType>(0);
-
-                    for (auto i : it) {
-                        if (instance_count >= instance_capacity) {
-                            break;
-                        }
+        if (cull_volume != nullptr) {
+            // The visible instances change with the camera, so there is no layout to keep, and the next frame without culling is a full upload.
+            renderer.uploaded_slices.clear();
+            const uint32_t visible_instance_count = pack_visible_multimesh_slices(slices, instance_count, renderer.use_colors, renderer.use_custom_data,
+                                                                                  *cull_volume, interpolation_alpha, worker_count, buffer.ptrw());
+            rendering_server->multimesh_set_buffer(renderer.rid, buffer);
+            rendering_server->multimesh_set_visible_instances(renderer.rid, static_cast<int32_t>(visible_instance_count));
+            return;
+        }
 
-                        uint32_t buffer_cursor = instance_count * floats_per_instance;
-                        const TransformType &transform = transform_field[i];
-
-                        if constexpr (std::is_same_v<TransformType, Transform2D>) {
-                            buffer_ptr[buffer_cursor++] = transform.columns[0].x;
-                            buffer_ptr[buffer_cursor++] = transform.columns[1].x;
-                            buffer_ptr[buffer_cursor++] = 0.0f;
-                            buffer_ptr[buffer_cursor++] = transform.columns[2].x;
-                            buffer_ptr[buffer_cursor++] = transform.columns[0].y;
-                            buffer_ptr[buffer_cursor++] = transform.columns[1].y;
-                            buffer_ptr[buffer_cursor++] = 0.0f;
-                            buffer_ptr[buffer_cursor++] = transform.columns[2].y;
-                        } else if constexpr (std::is_same_v<TransformType, Transform3D>) {
-                            // RenderingServer expects Transform3D data in a specific order (rows of the 3x4 matrix):
-                            const Vector3 &row0 = transform.basis.rows[0];
-                            const Vector3 &row1 = transform.basis.rows[1];
-                            const Vector3 &row2 = transform.basis.rows[2];
-
-                            buffer_ptr[buffer_cursor++] = row0.x;
-                            buffer_ptr[buffer_cursor++] = row1.x;
-                            buffer_ptr[buffer_cursor++] = row2.x;
-                            buffer_ptr[buffer_cursor++] = transform.origin.x;
-
-                            buffer_ptr[buffer_cursor++] = row0.y;
-                            buffer_ptr[buffer_cursor++] = row1.y;
-                            buffer_ptr[buffer_cursor++] = row2.y;
-                            buffer_ptr[buffer_cursor++] = transform.origin.y;
-
-                            buffer_ptr[buffer_cursor++] = row0.z;
-                            buffer_ptr[buffer_cursor++] = row1.z;
-                            buffer_ptr[buffer_cursor++] = row2.z;
-                            buffer_ptr[buffer_cursor++] = transform.origin.z;
-                        }
+        MultiMeshUpload upload = MultiMeshUpload::Full;
+        if (renderer.incremental_updates) {
+            bool layout_unchanged = interpolating == renderer.uploaded_interpolating && slices.size() == renderer.uploaded_slices.size();
+            for (size_t i = 0; layout_unchanged && i < slices.size(); ++i) {
+                layout_unchanged =
+                    get_transform_column(slices[i]) == renderer.uploaded_slices[i].transforms && slices[i].count == renderer.uploaded_slices[i].count;
+            }
+            upload = choose_multimesh_upload(layout_unchanged, dirty_instance_count, instance_count);
+        }
 
-                        int next_field_idx = 1;
-                        if (renderer.use_colors) {
-                            const Color &color = it.field<const Color>(next_field_idx++)[i];
-                            buffer_ptr[buffer_cursor++] = color.r;
-                            buffer_ptr[buffer_cursor++] = color.g;
-                            buffer_ptr[buffer_cursor++] = color.b;
-                            buffer_ptr[buffer_cursor++] = color.a;
-                        }
-                        if (renderer.use_custom_data) {
-                            const CustomData &custom_data = it.field<const CustomData>(next_field_idx++)[i];
-                            buffer_ptr[buffer_cursor++] = custom_data.x;
-                            buffer_ptr[buffer_cursor++] = custom_data.y;
-                            buffer_ptr[buffer_cursor++] = custom_data.z;
-                            buffer_ptr[buffer_cursor++] = custom_data.w;
-                        }
-                        instance_count++;
-                    }
+        // Second pass: pack the slices, each into its own part of the buffer.
+        switch (upload) {
+        case MultiMeshUpload::None:
+            break;
+        case MultiMeshUpload::Instances: {
+            // Packed into a buffer of their own: writing to the cached one would copy all of it if the RenderingServer still shares it.
+            thread_local std::vector<float> dirty_buffer;
+            dirty_buffer.resize(size_t{dirty_instance_count} * floats_per_instance);
+            pack_multimesh_slices(dirty_slices, dirty_instance_count, renderer.use_colors, renderer.use_custom_data, interpolation_alpha, worker_count,
+                                  dirty_buffer.data());
+            for (size_t i = 0; i < dirty_slices.size(); ++i) {
+                const float *packed = dirty_buffer.data() + size_t{dirty_slices[i].first_instance} * floats_per_instance;
+                upload_multimesh_instances<TransformType>(rendering_server, renderer, packed, dirty_slice_instances[i], dirty_slices[i].count);
+            }
+            break;
+        }
+        case MultiMeshUpload::Full:
+            pack_multimesh_slices(slices, instance_count, renderer.use_colors, renderer.use_custom_data, interpolation_alpha, worker_count, buffer.ptrw());
+            rendering_server->multimesh_set_buffer(renderer.rid, buffer);
+            rendering_server->multimesh_set_visible_instances(renderer.rid, static_cast<int32_t>(instance_count));
+            if (renderer.incremental_updates) {
+                renderer.uploaded_slices.clear();
+                for (const MultiMeshPackSlice<TransformType> &slice : slices) {
+                    renderer.uploaded_slices.push_back({get_transform_column(slice), slice.count});
                 }
-            });
-            if (instance_count >= instance_capacity) {
-                break;
+                renderer.uploaded_interpolating = interpolating;
             }
+            break;
         }
-
-        rendering_server->multimesh_set_buffer(renderer.rid, buffer);
-        rendering_server->multimesh_set_visible_instances(renderer.rid, static_cast<int32_t>(instance_count));
     }
 
     REGISTER([](flecs::world &world) {
@@ -167,7 +268,7 @@ namespace stagehand::rendering {
             if (!it.world().has<Renderers>()) {
                 return; // No renderers component
             }
-            const Renderers &renderers = it.world().get<Renderers>();
+            Renderers &renderers = it.world().get_mut<Renderers>();
 
             auto multimesh_renderers_it = renderers.renderers_by_type.find(RendererType::MultiMesh);
             if (multimesh_renderers_it == renderers.renderers_by_type.end()) {
@@ -181,13 +282,19 @@ namespace stagehand::rendering {
                 return;
             }
 
+            const interpolation::InterpolationAlpha *alpha = it.world().try_get<interpolation::InterpolationAlpha>();
+            const float interpolation_alpha = alpha != nullptr ? alpha->value : 1.0f;
+            const int32_t worker_count = it.real_world().get_stage_count();
+
             for (auto &prefab_renderer_pair : multimesh_renderers_it->second) {
-                const MultiMeshRendererConfig &renderer = prefab_renderer_pair.second;
+                MultiMeshRendererConfig &renderer = prefab_renderer_pair.second;
+                MultiMeshCullVolume cull_volume;
+                const MultiMeshCullVolume *culling = renderer.culling && get_multimesh_cull_volume(renderer, cull_volume) ? &cull_volume : nullptr;
 
                 if (renderer.transform_format == godot::MultiMesh::TRANSFORM_2D) {
-                    update_renderer_for_prefab<Transform2D>(rendering_server, renderer);
+                    update_renderer_for_prefab<Transform2D>(rendering_server, renderer, interpolation_alpha, worker_count, culling);
                 } else {
-                    update_renderer_for_prefab<Transform3D>(rendering_server, renderer);
+                    update_renderer_for_prefab<Transform3D>(rendering_server, renderer, interpolation_alpha, worker_count, culling);
                 }
             }
         });
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/simulation_lod.h"
+#include "stagehand/ecs/components/transform.h"
+#include "stagehand/ecs/systems/table_fields.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+
+namespace stagehand::lod {
+    namespace detail {
+        [[nodiscard]] inline float distance_squared(const godot::Vector3 &reference_point, const godot::Vector2 &position) {
+            return godot::Vector2(reference_point.x, reference_point.y).distance_squared_to(position);
+        }
+
+        [[nodiscard]] inline float distance_squared(const godot::Vector3 &reference_point, const godot::Vector3 &position) {
+            return reference_point.distance_squared_to(position);
+        }
+    } // namespace detail
+
+    /// Registers a system that updates the entities of each simulation LOD tier every `intervals[tier]` frames, e.g. {1, 2, 4, 8} updates
+    /// the nearest entities every frame and the farthest every eighth. Only entities with SimulationLod are matched.
+    /// The system keeps no state between runs, so `configure` may make it multi-threaded.
+    /// @param configure Called with the system builder; sets the phase and any extra terms, and returns the builder.
+    /// @param callback Called as `callback(flecs::entity, float delta_time, Components &...)` for every entity updated this frame.
+    /// `delta_time` is the time since the entity was last updated, assuming the frame time stayed the same.
+    template <typename... Components, typename Configure, typename Callback>
+    flecs::system register_lod_system(flecs::world &world, const char *name, const TierIntervals &intervals, Configure &&configure, Callback &&callback) {
+        auto run = [intervals, callback = std::forward<Callback>(callback)](flecs::iter &it) {
+            const int64_t frame = it.world().get_info()->frame_count_total;
+            while (it.next()) {
+                const flecs::field<const SimulationLod> lods = it.field<const SimulationLod>(static_cast<int8_t>(sizeof...(Components)));
+                const float delta_time = it.delta_time();
+                const auto fields = stagehand::detail::get_table_fields<Components...>(it);
+                for (auto i : it) {
+                    const uint8_t tier = lods[i].tier;
+                    const flecs::entity entity = it.entity(i);
+                    if (!is_update_frame(intervals, tier, entity.id(), frame)) {
+                        continue;
+                    }
+                    stagehand::detail::invoke_with_row(callback, fields, i, entity, scaled_delta_time(intervals, tier, delta_time));
+                }
+            }
+        };
+        return configure(world.system<Components..., const SimulationLod>(name)).run(std::move(run));
+    }
+
+    // Moves entities between tiers as they get closer to or farther from the reference point. Unassigned entities are assigned right away;
+    // the others are checked every SimulationLodSettings::reassignment_slices frames, spread evenly by entity id.
+    template <typename PositionType> void register_tier_assignment_system(flecs::world &world, const char *name) {
+        const std::array<flecs::entity_t, TIER_COUNT> tier_tags = {
+            world.component<Tier<0>>().id(),
+            world.component<Tier<1>>().id(),
+            world.component<Tier<2>>().id(),
+            world.component<Tier<3>>().id(),
+        };
+
+        world.system<SimulationLod, const PositionType, const SimulationLodSettings>(name)
+            .kind(flecs::PreUpdate)
+            .multi_threaded()
+            .run([tier_tags](flecs::iter &it) {
+                const int64_t frame = it.world().get_info()->frame_count_total;
+                while (it.next()) {
+                    flecs::field<SimulationLod> lods = it.field<SimulationLod>(0);
+                    const flecs::field<const PositionType> positions = it.field<const PositionType>(1);
+                    const SimulationLodSettings &settings = it.field<const SimulationLodSettings>(2)[0];
+                    const uint64_t slices = static_cast<uint64_t>(settings.reassignment_slices > 1 ? settings.reassignment_slices : 1);
+
+                    for (auto i : it) {
+                        SimulationLod &lod = lods[i];
+                        const flecs::entity entity = it.entity(i);
+                        if (lod.tier != UNASSIGNED_TIER &&
+                            (static_cast<uint64_t>(static_cast<uint32_t>(entity.id())) + static_cast<uint64_t>(frame)) % slices != 0) {
+                            continue;
+                        }
+
+                        const uint8_t tier = tier_for_distance_squared(settings, detail::distance_squared(settings.reference_point, positions[i]));
+                        if (tier == lod.tier) {
+                            continue;
+                        }
+                        // Entities start with every tier tag enabled.
+                        if (lod.tier == UNASSIGNED_TIER) {
+                            for (int32_t other = 0; other < TIER_COUNT; ++other) {
+                                if (other != tier) {
+                                    entity.disable(tier_tags[static_cast<size_t>(other)]);
+                                }
+                            }
+                        } else {
+                            entity.disable(tier_tags[lod.tier]);
+                            entity.enable(tier_tags[tier]);
+                        }
+                        lod.tier = tier;
+                    }
+                }
+            });
+    }
+
+    REGISTER([](flecs::world &world) {
+        register_tier_assignment_system<transform::Position2D>(world, names::systems::LOD_ASSIGN_TIERS_2D);
+        register_tier_assignment_system<transform::Position3D>(world, names::systems::LOD_ASSIGN_TIERS_3D);
+    });
+} // namespace stagehand::lod
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/tick_rate.h"
+#include "stagehand/ecs/systems/table_fields.h"
+
+namespace stagehand {
+    /// Registers a system that processes only a part of its entities on every run: with `slices` set to K, each run visits 1/K of the rows of
+    /// every matched table, and each entity is visited once every K runs. Meant for low-priority work that doesn't have to see every entity
+    /// every frame. Combine with .interval() in `configure`, or set_system_update_rate(), to also run less often.
+    /// Rows move when entities are removed, so a cycle may skip or repeat an entity that was moved. The system is single-threaded, since
+    /// all of its runs share one Stagger.
+    /// @param configure Called with the system builder; sets the phase and any extra terms, and returns the builder.
+    /// @param callback Called as `callback(flecs::entity, float delta_time, Components &...)` for every visited entity. `delta_time` is the
+    /// time since the entity was last visited, assuming the frame time stayed the same over the cycle.
+    /// @returns The system, which carries its Stagger.
+    template <typename... Components, typename Configure, typename Callback>
+    flecs::system register_staggered_system(flecs::world &world, const char *name, int32_t slices, Configure &&configure, Callback &&callback) {
+        auto run = [callback = std::forward<Callback>(callback)](flecs::iter &it) {
+            Stagger *stagger = it.real_world().entity(it.system().id()).try_get_mut<Stagger>();
+            const int32_t slice_count = stagger->slices;
+            const int32_t slice = stagger->next_slice;
+            stagger->next_slice = slice + 1 < slice_count ? slice + 1 : 0;
+            const float delta_time = it.delta_system_time() * static_cast<float>(slice_count);
+
+            while (it.next()) {
+                const int64_t count = static_cast<int64_t>(it.count());
+                const size_t begin = static_cast<size_t>(count * slice / slice_count);
+                const size_t end = static_cast<size_t>(count * (slice + 1) / slice_count);
+                const auto fields = detail::get_table_fields<Components...>(it);
+                for (size_t i = begin; i < end; ++i) {
+                    detail::invoke_with_row(callback, fields, i, it.entity(i), delta_time);
+                }
+            }
+        };
+
+        flecs::system system = configure(world.system<Components...>(name)).run(std::move(run));
+        system.set<Stagger>({slices > 1 ? slices : 1, 0});
+        return system;
+    }
+} // namespace stagehand
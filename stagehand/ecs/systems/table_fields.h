@@ -0,0 +1,27 @@
+/// Helpers for the system registration functions that call a per-entity callback with the entity's components.
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include "flecs.h"
+
+namespace stagehand::detail {
+    template <typename... Components, size_t... Indices>
+    [[nodiscard]] inline std::tuple<flecs::field<Components>...> get_table_fields(flecs::iter &it, std::index_sequence<Indices...>) {
+        return {it.field<Components>(static_cast<int8_t>(Indices))...};
+    }
+
+    /// Returns the fields of `Components`, the first terms of the query, in the table `it` is on. Fetch them once per table, after
+    /// it.next(), and pass them to invoke_with_row() for every row.
+    template <typename... Components> [[nodiscard]] inline std::tuple<flecs::field<Components>...> get_table_fields(flecs::iter &it) {
+        return get_table_fields<Components...>(it, std::index_sequence_for<Components...>{});
+    }
+
+    /// Calls `callback(leading..., Components &...)` with the components of `row`.
+    template <typename Callback, typename Fields, typename... Leading>
+    inline void invoke_with_row(Callback &callback, const Fields &fields, size_t row, Leading &&...leading) {
+        std::apply([&](const auto &...field) { callback(std::forward<Leading>(leading)..., field[row]...); }, fields);
+    }
+} // namespace stagehand::detail
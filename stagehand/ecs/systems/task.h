@@ -0,0 +1,28 @@
+#pragma once
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/task.h"
+#include "stagehand/ecs/pipeline_phases.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+
+namespace stagehand {
+    /// Registers the system that resumes the tasks waiting for `phase`. It runs before the other systems of the phase that were registered
+    /// after it, which is all of them for the built-in resume phases.
+    inline void register_task_phase(flecs::world &world, flecs::entity_t phase, const char *name) {
+        world.get<TaskSchedulerSingleton>().scheduler->add_resume_phase(phase);
+        world.system(name).kind(phase).run([phase](flecs::iter &it) {
+            it.world().get<TaskSchedulerSingleton>().scheduler->resume(phase);
+        });
+    }
+
+    REGISTER([](flecs::world &world) {
+        // next_frame() resumes tasks in the first of these.
+        world.get<TaskSchedulerSingleton>().scheduler->next_frame_phase = flecs::OnLoad;
+        register_task_phase(world, flecs::OnLoad, names::systems::TASKS_RESUME_ON_LOAD);
+        register_task_phase(world, flecs::OnUpdate, names::systems::TASKS_RESUME_ON_UPDATE);
+        register_task_phase(world, OnLateUpdate, names::systems::TASKS_RESUME_ON_LATE_UPDATE);
+        register_task_phase(world, flecs::OnStore, names::systems::TASKS_RESUME_ON_STORE);
+    });
+} // namespace stagehand
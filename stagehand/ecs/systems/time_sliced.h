@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+#include "flecs.h"
+
+#include "stagehand/ecs/components/time_budget.h"
+#include "stagehand/ecs/systems/table_fields.h"
+
+namespace stagehand {
+    namespace detail {
+        /// Processes the rows of `it` from the cursor on, until the deadline passes. Returns true when it did, with the cursor on the first
+        /// row not processed. The cursor's table must come up in `it` for anything to be processed when the cursor is set.
+        template <typename... Components, typename Callback>
+        bool run_time_sliced_tables(flecs::iter &it, TimeSlicedCursor &cursor, std::chrono::steady_clock::time_point deadline,
+                                    int32_t &processed_entities, Callback &callback) {
+            bool resuming = cursor.table != nullptr;
+            bool in_cursor_table = false;
+            while (it.next()) {
+                const ecs_iter_t *c_it = it.c_ptr();
+                int32_t begin = 0;
+                if (resuming) {
+                    if (c_it->table != cursor.table) {
+                        if (!in_cursor_table) {
+                            continue; // Not there yet
+                        }
+                        resuming = false; // The rest of the cursor's table was removed since the last frame
+                    } else {
+                        in_cursor_table = true;
+                        // A table is split into several ranges when the query matches toggled components.
+                        if (c_it->offset + c_it->count <= cursor.row) {
+                            continue;
+                        }
+                        begin = std::max(0, cursor.row - c_it->offset);
+                        resuming = false;
+                    }
+                }
+
+                const auto fields = get_table_fields<Components...>(it);
+                for (int32_t i = begin; i < c_it->count; ++i) {
+                    if (processed_entities > 0 && std::chrono::steady_clock::now() >= deadline) {
+                        cursor.table = c_it->table;
+                        cursor.row = c_it->offset + i;
+                        it.fini();
+                        return true;
+                    }
+                    const size_t row = static_cast<size_t>(i);
+                    invoke_with_row(callback, fields, row, it.entity(row));
+                    ++processed_entities;
+                }
+            }
+            return false;
+        }
+
+        inline void complete_time_sliced_pass(TimeSlicedCursor &cursor) {
+            cursor.table = nullptr;
+            cursor.row = 0;
+            ++cursor.completed_passes;
+        }
+    } // namespace detail
+
+    /// Registers a single-threaded system in `phase` that stops iterating once the phase's time budget (see PhaseTimeBudget) is used up,
+    /// and resumes on the next frame from the table and row it stopped at. Meant for expensive maintenance work that doesn't have to see
+    /// every entity every frame. At least one entity is processed per frame, so a pass always finishes eventually.
+    /// The clock is read before every entity, so the per-entity work should be well above the cost of that (tens of nanoseconds).
+    /// If tables are created or deleted mid-pass the iteration order can change, and that pass may skip or repeat some entities. When the
+    /// cursor's table stops matching, or nothing is left after the cursor, the pass ends and the next one starts in the same run.
+    /// The budget is per world frame, i.e. per world.progress(): in PROGRESS_TICK_FIXED mode every fixed tick gets the full budget, so a
+    /// displayed frame that runs several ticks spends up to that many budgets.
+    /// @param configure Called with the system builder; adds any extra terms and returns the builder. The phase is already set.
+    /// @param callback Called as `callback(flecs::entity, Components &...)` for every processed entity.
+    /// @returns The system, which carries its TimeSlicedCursor.
+    template <typename... Components, typename Configure, typename Callback>
+    flecs::system register_time_sliced_system(flecs::world &world, const char *name, flecs::entity_t phase, Configure &&configure, Callback &&callback) {
+        auto run = [phase, callback = std::forward<Callback>(callback)](flecs::iter &it) {
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            flecs::world real_world = it.real_world();
+            TimeSlicedCursor *cursor = real_world.entity(it.system().id()).try_get_mut<TimeSlicedCursor>();
+            PhaseTimeBudget *budget = real_world.entity(phase).try_get_mut<PhaseTimeBudget>();
+
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+            if (budget) {
+                const int64_t frame = real_world.get_info()->frame_count_total;
+                if (budget->frame != frame) {
+                    budget->frame = frame;
+                    budget->used_milliseconds = 0.0;
+                }
+                const double remaining_milliseconds = std::max(0.0, budget->budget_milliseconds - budget->used_milliseconds);
+                deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                       std::chrono::duration<double, std::milli>(remaining_milliseconds));
+            }
+
+            const bool resumed = cursor->table != nullptr;
+            int32_t processed_entities = 0;
+            bool out_of_time = detail::run_time_sliced_tables<Components...>(it, *cursor, deadline, processed_entities, callback);
+            if (!out_of_time) {
+                detail::complete_time_sliced_pass(*cursor);
+                // Nothing was left after the cursor: its table no longer matches, or lost the rows after it. Start the next pass in this run
+                // too, so a run never processes nothing while the system has entities.
+                if (resumed && processed_entities == 0) {
+                    flecs::system(it.real_world(), it.system()).query().iter(it.world()).run([&](flecs::iter &restart) {
+                        out_of_time = detail::run_time_sliced_tables<Components...>(restart, *cursor, deadline, processed_entities, callback);
+                    });
+                    if (!out_of_time) {
+                        detail::complete_time_sliced_pass(*cursor);
+                    }
+                }
+            }
+            cursor->processed_entities = processed_entities;
+            if (budget) {
+                budget->used_milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+        };
+
+        flecs::system system = configure(world.system<Components...>(name).kind(phase)).run(std::move(run));
+        system.set<TimeSlicedCursor>({});
+        return system;
+    }
+} // namespace stagehand
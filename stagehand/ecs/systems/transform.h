@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
 #include <godot_cpp/variant/basis.hpp>
@@ -7,9 +8,11 @@
 #include "stagehand/ecs/components/godot_variants.h"
 #include "stagehand/ecs/components/transform.h"
 #include "stagehand/ecs/pipeline_phases.h"
+#include "stagehand/ecs/systems/parallelism.h"
 #include "stagehand/entity.h"
 #include "stagehand/names.h"
 #include "stagehand/registry.h"
+#include "stagehand/utilities/render_transform_layout.h"
 
 namespace stagehand::transform {
 
@@ -24,6 +27,8 @@ namespace stagehand::transform {
         using Rotation = std::conditional_t<IS_2D, Rotation2D, Rotation3D>;
         using Scale = std::conditional_t<IS_2D, Scale2D, Scale3D>;
 
+        using RenderTransform = std::conditional_t<IS_2D, RenderTransform2D, RenderTransform3D>;
+
         using HasChangedPosition = std::conditional_t<IS_2D, HasChangedPosition2D, HasChangedPosition3D>;
         using HasChangedRotation = std::conditional_t<IS_2D, HasChangedRotation2D, HasChangedRotation3D>;
         using HasChangedScale = std::conditional_t<IS_2D, HasChangedScale2D, HasChangedScale3D>;
@@ -57,28 +62,34 @@ namespace stagehand::transform {
         }
     };
 
+    /// Fewest changed entities for which the transform systems are split across threads. Below it, composing or decomposing the transforms
+    /// takes less time than waking up and synchronising the workers.
+    constexpr int32_t TRANSFORM_PARALLEL_MIN_ENTITIES = 1024;
+
     template <typename TransformT> void register_transform_decompose_system(flecs::world &world) {
         using Traits = TransformSystemTraits<TransformT>;
 
         // clang-format off
-        world.system<
+        register_adaptive_system<
                 const typename Traits::Transform,
                 typename Traits::Position,
                 typename Traits::Rotation,
                 typename Traits::Scale
-            >(Traits::DECOMPOSE_SYSTEM_NAME)
-            .kind(flecs::PostLoad)
-            .template with<typename Traits::HasChangedTransform>()
-            .multi_threaded()
-            .each([](
-                stagehand::entity entity,
-                const typename Traits::Transform &transform,
-                typename Traits::Position &position,
-                typename Traits::Rotation &rotation,
-                typename Traits::Scale &scale
-            ){
+            >(world, Traits::DECOMPOSE_SYSTEM_NAME, TRANSFORM_PARALLEL_MIN_ENTITIES,
+            [](auto &&builder) -> auto & {
+                return builder
+                    .kind(flecs::PostLoad)
+                    .template with<typename Traits::HasChangedTransform>();
+            },
+            [](flecs::iter &it) {
                 // clang-format on
-                Traits::decompose_transform(entity, transform, position, rotation, scale);
+                auto transforms = it.field<const typename Traits::Transform>(0);
+                auto positions = it.field<typename Traits::Position>(1);
+                auto rotations = it.field<typename Traits::Rotation>(2);
+                auto scales = it.field<typename Traits::Scale>(3);
+                for (auto i : it) {
+                    Traits::decompose_transform(stagehand::entity(it.entity(i)), transforms[i], positions[i], rotations[i], scales[i]);
+                }
             });
     }
 
@@ -86,31 +97,41 @@ namespace stagehand::transform {
         using Traits = TransformSystemTraits<TransformT>;
 
         // clang-format off
-        world.system<
+        register_adaptive_system<
                 typename Traits::Transform,
                 const typename Traits::Position,
                 const typename Traits::Rotation,
-                const typename Traits::Scale
-            >(Traits::COMPOSE_SYSTEM_NAME)
-            .kind(stagehand::PreRender)
-            .template with<const typename Traits::HasChangedPosition>()
-                .or_()
-            .template with<const typename Traits::HasChangedRotation>()
-                .or_()
-            .template with<const typename Traits::HasChangedScale>()
-            .template term_at<typename Traits::Transform>().out()
-            .template write<typename Traits::HasChangedTransform>()
-            .multi_threaded()
-            .each([](
-                stagehand::entity entity,
-                typename Traits::Transform &transform,
-                const typename Traits::Position &position,
-                const typename Traits::Rotation &rotation,
-                const typename Traits::Scale &scale
-            ){
+                const typename Traits::Scale,
+                typename Traits::RenderTransform
+            >(world, Traits::COMPOSE_SYSTEM_NAME, TRANSFORM_PARALLEL_MIN_ENTITIES,
+            [](auto &&builder) -> auto & {
+                return builder
+                    .kind(stagehand::PreRender)
+                    .template with<const typename Traits::HasChangedPosition>()
+                        .or_()
+                    .template with<const typename Traits::HasChangedRotation>()
+                        .or_()
+                    .template with<const typename Traits::HasChangedScale>()
+                    .template term_at<typename Traits::Transform>().out()
+                    .template term_at<typename Traits::RenderTransform>().out().optional()
+                    .template write<typename Traits::HasChangedTransform>();
+            },
+            [](flecs::iter &it) {
                 // clang-format on
-                entity.modify(transform,
-                              [&](typename Traits::Transform &current_transform) { Traits::compose_transform(current_transform, position, rotation, scale); });
+                auto transforms = it.field<typename Traits::Transform>(0);
+                auto positions = it.field<const typename Traits::Position>(1);
+                auto rotations = it.field<const typename Traits::Rotation>(2);
+                auto scales = it.field<const typename Traits::Scale>(3);
+                typename Traits::RenderTransform *render_transforms = it.is_set(4) ? &it.field<typename Traits::RenderTransform>(4)[0] : nullptr;
+                for (auto i : it) {
+                    stagehand::entity entity(it.entity(i));
+                    entity.modify(transforms[i], [&](typename Traits::Transform &current_transform) {
+                        Traits::compose_transform(current_transform, positions[i], rotations[i], scales[i]);
+                    });
+                    if (render_transforms != nullptr) {
+                        stagehand::rendering::pack_render_transform(transforms[i], render_transforms[i].data.data());
+                    }
+                }
             });
     }
 
@@ -118,6 +139,7 @@ namespace stagehand::transform {
     // When a Transform2D/3D component is changed (e.g. by physics feedback or user code setting the composite transform directly),
     // decompose it into Position, Rotation, and Scale components.
     // Runs at PostLoad so it executes before user-facing OnUpdate systems.
+    // Both transform systems only split the work across threads when enough entities changed (see register_adaptive_system()).
 
     REGISTER([](flecs::world &world) {
         register_transform_decompose_system<Transform2D>(world);
@@ -127,6 +149,7 @@ namespace stagehand::transform {
     // ─── Transform Compose (PreRender) ───────────────────────────────────
     // When Position, Rotation, or Scale components change, recompose the Transform2D/3D component.
     // This feeds rendering and other downstream systems that consume the composite transform.
+    // Entities with a RenderTransform2D/3D also get the new transform in MultiMesh buffer layout, which renderers copy as is.
 
     REGISTER([](flecs::world &world) {
         register_transform_compose_system<Transform2D>(world);
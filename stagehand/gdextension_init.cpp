@@ -9,6 +9,7 @@
 #include "stagehand/editor/flecs_script_editor_export_plugin.h"
 #include "stagehand/nodes/instanced_renderer_3d.h"
 #include "stagehand/nodes/multi_mesh_renderer.h"
+#include "stagehand/query.h"
 #include "stagehand/world.h"
 
 void initialize_flecs_module(godot::ModuleInitializationLevel p_level) {
@@ -17,6 +18,7 @@ void initialize_flecs_module(godot::ModuleInitializationLevel p_level) {
     }
 
     GDREGISTER_RUNTIME_CLASS(stagehand::FlecsWorld);
+    GDREGISTER_ABSTRACT_CLASS(stagehand::FlecsQuery);
 
     GDREGISTER_CLASS(InstancedRenderer3D);
     GDREGISTER_CLASS(InstancedRenderer3DLODConfiguration);
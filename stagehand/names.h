@@ -12,12 +12,32 @@ namespace stagehand::names {
         constexpr const char *PRE_RENDER = NAMESPACE_STR "::PreRender";
         constexpr const char *ON_RENDER = NAMESPACE_STR "::OnRender";
         constexpr const char *POST_RENDER = NAMESPACE_STR "::PostRender";
+        constexpr const char *PRESENTATION_PHASE = NAMESPACE_STR "::PresentationPhase";
+        constexpr const char *UPDATE_PHASE = NAMESPACE_STR "::UpdatePhase";
     } // namespace phases
 
+    namespace pipelines {
+        constexpr const char *SIMULATION = NAMESPACE_STR "::SimulationPipeline";
+        constexpr const char *PRESENTATION = NAMESPACE_STR "::PresentationPipeline";
+        constexpr const char *ASYNC_SIMULATION = NAMESPACE_STR "::AsyncSimulationPipeline";
+        constexpr const char *MAIN_THREAD_PRE_UPDATE = NAMESPACE_STR "::MainThreadPreUpdatePipeline";
+        constexpr const char *MAIN_THREAD_POST_UPDATE = NAMESPACE_STR "::MainThreadPostUpdatePipeline";
+        constexpr const char *MAIN_THREAD_SYSTEM = NAMESPACE_STR "::MainThreadSystem";
+    } // namespace pipelines
+
     namespace systems {
         constexpr const char *ENTITY_RENDERING_COMPUTE = NAMESPACE_STR "::rendering::Entity Rendering (Compute)";
         constexpr const char *ENTITY_RENDERING_INSTANCED = NAMESPACE_STR "::rendering::Entity Rendering (Instanced)";
         constexpr const char *ENTITY_RENDERING_MULTIMESH = NAMESPACE_STR "::rendering::Entity Rendering (MultiMesh)";
+        constexpr const char *EVENT_QUEUES_EMIT_SIGNALS = NAMESPACE_STR "::events::Emit Queued Signals";
+        constexpr const char *EVENT_QUEUES_PREPARE = NAMESPACE_STR "::events::Prepare Event Queues";
+        constexpr const char *INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_2D = NAMESPACE_STR "::interpolation::Snapshot Previous Godot Transform (2D)";
+        constexpr const char *INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_3D = NAMESPACE_STR "::interpolation::Snapshot Previous Godot Transform (3D)";
+        constexpr const char *INTERPOLATION_SNAPSHOT_TRANSFORM_2D = NAMESPACE_STR "::interpolation::Snapshot Previous Transform (2D)";
+        constexpr const char *INTERPOLATION_SNAPSHOT_TRANSFORM_3D = NAMESPACE_STR "::interpolation::Snapshot Previous Transform (3D)";
+        constexpr const char *LOD_ASSIGN_TIERS_2D = NAMESPACE_STR "::lod::Assign Simulation LOD Tiers (2D)";
+        constexpr const char *LOD_ASSIGN_TIERS_3D = NAMESPACE_STR "::lod::Assign Simulation LOD Tiers (3D)";
+        constexpr const char *PARALLELISM_UPDATE = NAMESPACE_STR "::parallelism::Update System Parallelism";
         constexpr const char *PHYSICS_BODY_SPACE_ASSIGNMENT_2D = NAMESPACE_STR "::physics::Body Space Assignment (2D)";
         constexpr const char *PHYSICS_BODY_SPACE_ASSIGNMENT_3D = NAMESPACE_STR "::physics::Body Space Assignment (3D)";
         constexpr const char *PHYSICS_FEEDBACK_ANGULAR_VELOCITY_2D = NAMESPACE_STR "::physics::Feedback Angular Velocity (2D)";
@@ -36,6 +56,10 @@ namespace stagehand::names {
         constexpr const char *PHYSICS_SYNC_VELOCITY_3D = NAMESPACE_STR "::physics::Sync Velocity (3D)";
         constexpr const char *PREFAB_INSTANTIATION = NAMESPACE_STR "::Prefab Instantiation";
         constexpr const char *TAG_RESET_CHANGE_DETECTION = NAMESPACE_STR "::Tag Reset (Change Detection)";
+        constexpr const char *TASKS_RESUME_ON_LATE_UPDATE = NAMESPACE_STR "::tasks::Resume Tasks (OnLateUpdate)";
+        constexpr const char *TASKS_RESUME_ON_LOAD = NAMESPACE_STR "::tasks::Resume Tasks (OnLoad)";
+        constexpr const char *TASKS_RESUME_ON_STORE = NAMESPACE_STR "::tasks::Resume Tasks (OnStore)";
+        constexpr const char *TASKS_RESUME_ON_UPDATE = NAMESPACE_STR "::tasks::Resume Tasks (OnUpdate)";
         constexpr const char *TRANSFORM_COMPOSE_2D = NAMESPACE_STR "::transform::Transform Compose (2D)";
         constexpr const char *TRANSFORM_COMPOSE_3D = NAMESPACE_STR "::transform::Transform Compose (3D)";
         constexpr const char *TRANSFORM_DECOMPOSE_2D = NAMESPACE_STR "::transform::Transform Decompose (2D)";
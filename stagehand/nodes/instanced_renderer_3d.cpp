@@ -7,10 +7,12 @@
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include "stagehand/ecs/components/interpolation.h"
 #include "stagehand/ecs/components/traits.h"
 #include "stagehand/ecs/components/transform.h"
 
-void register_instanced_renderer(flecs::world &world, InstancedRenderer3D *renderer, stagehand::rendering::Renderers &renderers, int &renderer_count) {
+void register_instanced_renderer(flecs::world &world, stagehand::PrefabRegistry &prefab_registry, InstancedRenderer3D *renderer,
+                                 stagehand::rendering::Renderers &renderers, int &renderer_count) {
     if (!renderer->validate_configuration()) {
         return;
     }
@@ -21,9 +23,8 @@ void register_instanced_renderer(flecs::world &world, InstancedRenderer3D *rende
     std::vector<flecs::entity> prefab_entities;
     prefab_entities.reserve(prefabs.size());
     for (int i = 0; i < prefabs.size(); ++i) {
-        const godot::String prefab_name = prefabs[i];
-        const std::string prefab_name_str = prefab_name.utf8().get_data();
-        flecs::entity prefab_entity = world.lookup(prefab_name_str.c_str());
+        const godot::StringName prefab_name = prefabs[i];
+        const flecs::entity prefab_entity(world, prefab_registry.resolve(world, prefab_name));
         if (!prefab_entity.is_valid()) {
             godot::UtilityFunctions::push_warning(godot::String("InstancedRenderer3D '") + renderer->get_name() + "': Prefab not found: " + prefab_name);
             continue;
@@ -51,6 +52,10 @@ void register_instanced_renderer(flecs::world &world, InstancedRenderer3D *rende
     auto transform_update_query_builder = world.query_builder<const stagehand::transform::Transform3D, const stagehand::transform::HasChangedTransform3D>();
     add_prefab_filters(transform_update_query_builder);
 
+    auto interpolation_query_builder =
+        world.query_builder<const stagehand::transform::Transform3D, const stagehand::interpolation::Previous<stagehand::transform::Transform3D>>();
+    add_prefab_filters(interpolation_query_builder);
+
     std::vector<flecs::entity> found_instance_uniform_components;
     found_instance_uniform_components.reserve(16);
     std::unordered_set<ecs_entity_t> seen_uniform_component_ids;
@@ -174,6 +179,7 @@ void register_instanced_renderer(flecs::world &world, InstancedRenderer3D *rende
     config.lod_configs = std::move(lod_configs);
     config.reconcile_query = reconcile_query_builder.build();
     config.transform_update_query = transform_update_query_builder.build();
+    config.interpolation_query = interpolation_query_builder.build();
     config.initial_uniforms = std::move(initial_uniform_configs);
     config.uniform_updates = std::move(uniform_update_configs);
     renderers.instanced_renderers.push_back(std::move(config));
@@ -1,9 +1,12 @@
 #include "stagehand/nodes/multi_mesh_renderer.h"
 
+#include <vector>
+
 #include <godot_cpp/classes/multi_mesh.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include "stagehand/ecs/components/transform.h"
 #include "stagehand/ecs/systems/rendering_multimesh.h"
 
 std::unordered_map<godot::RID, godot::PackedFloat32Array> g_multimesh_buffer_cache;
@@ -46,7 +49,8 @@ template class MultiMeshRenderer<godot::MultiMeshInstance2D>;
 template class MultiMeshRenderer<godot::MultiMeshInstance3D>;
 
 template <MultiMeshRendererType T>
-void register_multimesh_renderer(flecs::world &world, T *renderer, stagehand::rendering::Renderers &renderers, int &renderer_count) {
+void register_multimesh_renderer(flecs::world &world, stagehand::PrefabRegistry &prefab_registry, T *renderer, stagehand::rendering::Renderers &renderers,
+                                 int &renderer_count) {
     godot::RID multimesh_rid;
     godot::MultiMesh *multimesh = nullptr;
     const godot::PackedStringArray prefabs = renderer->get_prefabs_rendered();
@@ -83,6 +87,22 @@ void register_multimesh_renderer(flecs::world &world, T *renderer, stagehand::re
         return;
     }
 
+    std::vector<flecs::entity_t> prefab_ids;
+    prefab_ids.reserve(prefabs.size());
+    for (int j = 0; j < prefabs.size(); ++j) {
+        const godot::StringName prefab_name = prefabs[j];
+        const flecs::entity_t prefab_id = prefab_registry.resolve(world, prefab_name);
+        if (prefab_id == 0) {
+            godot::UtilityFunctions::push_warning(godot::String("MultiMeshRenderer '") + renderer->get_name() + "': Prefab not found: " + prefab_name);
+            continue;
+        }
+        prefab_ids.push_back(prefab_id);
+    }
+    // Without any IsA term the query would match every entity with a transform, so a renderer none of whose prefabs exist draws nothing.
+    if (prefab_ids.empty()) {
+        return;
+    }
+
     auto &renderer_map = renderers.renderers_by_type[stagehand::rendering::RendererType::MultiMesh];
     // Use RID directly as the key. try_emplace will create a new renderer only if one for this RID doesn't exist.
     auto [it, inserted] = renderer_map.try_emplace(multimesh_rid);
@@ -93,6 +113,10 @@ void register_multimesh_renderer(flecs::world &world, T *renderer, stagehand::re
         it->second.use_custom_data = multimesh->is_using_custom_data();
         it->second.instance_count = multimesh->get_instance_count();
         it->second.visible_instance_count = multimesh->get_visible_instance_count();
+        it->second.incremental_updates = renderer->get_incremental_updates();
+        it->second.culling = renderer->get_culling();
+        it->second.cull_margin = renderer->get_cull_margin();
+        it->second.node_id = godot::ObjectID(renderer->get_instance_id());
         renderer_count++;
     }
     stagehand::rendering::MultiMeshRendererConfig *mm_renderer = &it->second;
@@ -102,8 +126,17 @@ void register_multimesh_renderer(flecs::world &world, T *renderer, stagehand::re
     auto query = world.query_builder();
 
     using TransformType = std::conditional_t<std::is_same_v<T, MultiMeshRenderer2D>, godot::Transform2D, godot::Transform3D>;
+    using RenderTransformType =
+        std::conditional_t<std::is_same_v<T, MultiMeshRenderer2D>, stagehand::transform::RenderTransform2D, stagehand::transform::RenderTransform3D>;
 
-    query.with<const TransformType>();
+    // Entities are drawn with their Godot transform, or else with their render transform, which is already in the layout of the buffer.
+    // Sorting needs the Godot transform, so sorted renderers only draw entities that have one.
+    if (sort_axis != '\0') {
+        query.with<const TransformType>();
+    } else {
+        query.with<const TransformType>().optional();
+    }
+    query.with<const RenderTransformType>().optional();
 
     if (sort_axis != '\0') {
         switch (sort_axis) {
@@ -127,14 +160,23 @@ void register_multimesh_renderer(flecs::world &world, T *renderer, stagehand::re
     if (multimesh->is_using_custom_data()) {
         query.with<const stagehand::rendering::CustomData>();
     }
+    // Must stay the last data terms, in this order: the rendering system expects them right after the optional color and custom data terms.
+    // Render transforms are blended from the transform component they are composed from, when the entity has its Previous.
+    using TransformComponentType = stagehand::rendering::TransformComponentFor<TransformType>;
+    query.with<const stagehand::interpolation::Previous<TransformType>>().optional();
+    query.with<const TransformComponentType>().optional();
+    query.with<const stagehand::interpolation::Previous<TransformComponentType>>().optional();
+
+    if (mm_renderer->incremental_updates) {
+        // Lets the rendering system tell which tables were written to since the last frame.
+        query.cached().detect_changes();
+    }
 
     // Chain prefabs with the OR operator. The logic is to add `.or_()` to all but the last term.
-    int prefab_count = prefabs.size();
-    for (int j = 0; j < prefab_count; ++j) {
-        godot::String prefab_name = prefabs[j];
-        std::string prefab_name_str = prefab_name.utf8().get_data();
-        query.with(flecs::IsA, world.lookup(prefab_name_str.c_str()));
-        if (j < prefab_count - 1) {
+    const size_t prefab_count = prefab_ids.size();
+    for (size_t j = 0; j < prefab_count; ++j) {
+        query.with(flecs::IsA, prefab_ids[j]);
+        if (j + 1 < prefab_count) {
             query.or_();
         }
     }
@@ -142,9 +184,11 @@ void register_multimesh_renderer(flecs::world &world, T *renderer, stagehand::re
     mm_renderer->queries.push_back(query.build());
 }
 
-template void register_multimesh_renderer<MultiMeshRenderer2D>(flecs::world &, MultiMeshRenderer2D *, stagehand::rendering::Renderers &, int &);
+template void register_multimesh_renderer<MultiMeshRenderer2D>(flecs::world &, stagehand::PrefabRegistry &, MultiMeshRenderer2D *, stagehand::rendering::Renderers &,
+                                                               int &);
 
-template void register_multimesh_renderer<MultiMeshRenderer3D>(flecs::world &, MultiMeshRenderer3D *, stagehand::rendering::Renderers &, int &);
+template void register_multimesh_renderer<MultiMeshRenderer3D>(flecs::world &, stagehand::PrefabRegistry &, MultiMeshRenderer3D *, stagehand::rendering::Renderers &,
+                                                               int &);
 
 template <typename T> void bind_multimesh_renderer_methods() {
     godot::ClassDB::bind_method(godot::D_METHOD("set_prefabs_rendered", "prefabs"),
@@ -152,6 +196,12 @@ template <typename T> void bind_multimesh_renderer_methods() {
     godot::ClassDB::bind_method(godot::D_METHOD("get_prefabs_rendered"), static_cast<godot::PackedStringArray (T::*)() const>(&T::get_prefabs_rendered));
     godot::ClassDB::bind_method(godot::D_METHOD("set_draw_order", "draw_order"), static_cast<void (T::*)(MultiMeshDrawOrder)>(&T::set_draw_order));
     godot::ClassDB::bind_method(godot::D_METHOD("get_draw_order"), static_cast<MultiMeshDrawOrder (T::*)() const>(&T::get_draw_order));
+    godot::ClassDB::bind_method(godot::D_METHOD("set_incremental_updates", "enabled"), static_cast<void (T::*)(bool)>(&T::set_incremental_updates));
+    godot::ClassDB::bind_method(godot::D_METHOD("get_incremental_updates"), static_cast<bool (T::*)() const>(&T::get_incremental_updates));
+    godot::ClassDB::bind_method(godot::D_METHOD("set_culling", "enabled"), static_cast<void (T::*)(bool)>(&T::set_culling));
+    godot::ClassDB::bind_method(godot::D_METHOD("get_culling"), static_cast<bool (T::*)() const>(&T::get_culling));
+    godot::ClassDB::bind_method(godot::D_METHOD("set_cull_margin", "margin"), static_cast<void (T::*)(float)>(&T::set_cull_margin));
+    godot::ClassDB::bind_method(godot::D_METHOD("get_cull_margin"), static_cast<float (T::*)() const>(&T::get_cull_margin));
 
     godot::ClassDB::add_property(T::get_class_static(), godot::PropertyInfo(godot::Variant::PACKED_STRING_ARRAY, "prefabs_rendered"), "set_prefabs_rendered",
                                  "get_prefabs_rendered");
@@ -164,6 +214,13 @@ template <typename T> void bind_multimesh_renderer_methods() {
                                      "set_draw_order", "get_draw_order");
     }
 
+    godot::ClassDB::add_property(T::get_class_static(), godot::PropertyInfo(godot::Variant::BOOL, "incremental_updates"), "set_incremental_updates",
+                                 "get_incremental_updates");
+    godot::ClassDB::add_property(T::get_class_static(), godot::PropertyInfo(godot::Variant::BOOL, "culling"), "set_culling", "get_culling");
+    godot::ClassDB::add_property(T::get_class_static(),
+                                 godot::PropertyInfo(godot::Variant::FLOAT, "cull_margin", godot::PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater"),
+                                 "set_cull_margin", "get_cull_margin");
+
     godot::ClassDB::bind_integer_constant(T::get_class_static(), godot::StringName(), "MULTIMESH_DRAW_ORDER_NONE", MULTIMESH_DRAW_ORDER_NONE);
     godot::ClassDB::bind_integer_constant(T::get_class_static(), godot::StringName(), "MULTIMESH_DRAW_ORDER_X", MULTIMESH_DRAW_ORDER_X);
     godot::ClassDB::bind_integer_constant(T::get_class_static(), godot::StringName(), "MULTIMESH_DRAW_ORDER_Y", MULTIMESH_DRAW_ORDER_Y);
@@ -13,6 +13,7 @@
 #include "flecs.h"
 
 #include "stagehand/ecs/components/rendering.h"
+#include "stagehand/prefab_registry.h"
 #include "stagehand/utilities/godot_hashes.h" // IWYU pragma: keep
 
 enum MultiMeshDrawOrder {
@@ -33,11 +34,23 @@ template <typename T> class MultiMeshRenderer : public T {
     void set_draw_order(MultiMeshDrawOrder p_draw_order) { draw_order = p_draw_order; }
     [[nodiscard]] MultiMeshDrawOrder get_draw_order() const { return draw_order; }
 
+    void set_incremental_updates(bool p_incremental_updates) { incremental_updates = p_incremental_updates; }
+    [[nodiscard]] bool get_incremental_updates() const { return incremental_updates; }
+
+    void set_culling(bool p_culling) { culling = p_culling; }
+    [[nodiscard]] bool get_culling() const { return culling; }
+
+    void set_cull_margin(float p_cull_margin) { cull_margin = p_cull_margin; }
+    [[nodiscard]] float get_cull_margin() const { return cull_margin; }
+
     [[nodiscard]] godot::PackedStringArray _get_configuration_warnings() const override;
 
   private:
     godot::PackedStringArray prefabs_rendered;
     MultiMeshDrawOrder draw_order = MULTIMESH_DRAW_ORDER_NONE;
+    bool incremental_updates = false;
+    bool culling = false;
+    float cull_margin = 0.0f;
 };
 
 class MultiMeshRenderer2D : public MultiMeshRenderer<godot::MultiMeshInstance2D> {
@@ -69,6 +82,7 @@ concept MultiMeshRendererType = std::is_same_v<T, MultiMeshRenderer2D> || std::i
 
 // Helper to register a Godot MultiMesh node into the ECS world
 template <MultiMeshRendererType T>
-void register_multimesh_renderer(flecs::world &world, T *renderer, stagehand::rendering::Renderers &renderers, int &renderer_count);
+void register_multimesh_renderer(flecs::world &world, stagehand::PrefabRegistry &prefab_registry, T *renderer, stagehand::rendering::Renderers &renderers,
+                                 int &renderer_count);
 
 VARIANT_ENUM_CAST(MultiMeshDrawOrder);
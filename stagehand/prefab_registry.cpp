@@ -0,0 +1,52 @@
+#include "stagehand/prefab_registry.h"
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+namespace stagehand {
+
+    flecs::entity_t PrefabRegistry::lookup(const flecs::world &world, const godot::StringName &prefab_name) {
+        return world.lookup(godot::String(prefab_name).utf8().get_data()).id();
+    }
+
+    int64_t PrefabRegistry::get_handle(const flecs::world &world, const godot::StringName &prefab_name) {
+        if (const auto it = handles.find(prefab_name); it != handles.end()) {
+            return it->second;
+        }
+
+        const flecs::entity_t prefab_id = lookup(world, prefab_name);
+        if (prefab_id == 0) {
+            return -1;
+        }
+
+        const int64_t handle = static_cast<int64_t>(entries.size());
+        entries.push_back({prefab_name, prefab_id});
+        handles.emplace(prefab_name, handle);
+        return handle;
+    }
+
+    flecs::entity_t PrefabRegistry::resolve(const flecs::world &world, int64_t handle) {
+        if (unlikely(!is_valid_handle(handle))) {
+            return 0;
+        }
+
+        Entry &entry = entries[handle];
+        if (likely(entry.id != 0 && world.is_alive(entry.id))) {
+            return entry.id;
+        }
+
+        entry.id = lookup(world, entry.name);
+        return entry.id;
+    }
+
+    flecs::entity_t PrefabRegistry::resolve(const flecs::world &world, const godot::StringName &prefab_name) {
+        return resolve(world, get_handle(world, prefab_name));
+    }
+
+    void PrefabRegistry::invalidate() {
+        for (Entry &entry : entries) {
+            entry.id = 0;
+        }
+    }
+
+} // namespace stagehand
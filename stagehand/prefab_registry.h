@@ -0,0 +1,42 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <godot_cpp/variant/string_name.hpp>
+
+#include "flecs.h"
+
+#include "stagehand/utilities/godot_hashes.h" // IWYU pragma: keep
+
+namespace stagehand {
+
+    /// Resolves prefab names to prefab entities once and hands out stable integer handles for them, so spawn-heavy code doesn't repeat
+    /// the string path lookup on every call.
+    class PrefabRegistry {
+      public:
+        /// Returns the handle for a prefab name, registering the name on first use.
+        /// @return The handle, or -1 if the name has never been resolved and no prefab with that name exists.
+        [[nodiscard]] int64_t get_handle(const flecs::world &world, const godot::StringName &prefab_name);
+        /// Returns the prefab entity for a handle. The cached entity is looked up by name again if it was invalidated or is no longer alive.
+        /// @return The prefab entity ID, or 0 if the handle is invalid or the prefab no longer exists.
+        [[nodiscard]] flecs::entity_t resolve(const flecs::world &world, int64_t handle);
+        /// Convenience overload that resolves a prefab name through its handle.
+        [[nodiscard]] flecs::entity_t resolve(const flecs::world &world, const godot::StringName &prefab_name);
+        [[nodiscard]] bool is_valid_handle(int64_t handle) const { return handle >= 0 && handle < static_cast<int64_t>(entries.size()); }
+        /// Drops every cached entity ID so that the next resolve() looks the names up again. Handles stay valid.
+        /// Call this whenever scripts that may (re)define prefabs have been run.
+        void invalidate();
+
+      private:
+        struct Entry {
+            godot::StringName name;
+            flecs::entity_t id = 0;
+        };
+        std::vector<Entry> entries;
+        std::unordered_map<godot::StringName, int64_t> handles;
+
+        [[nodiscard]] static flecs::entity_t lookup(const flecs::world &world, const godot::StringName &prefab_name);
+    };
+
+} // namespace stagehand
@@ -0,0 +1,122 @@
+#include "stagehand/query.h"
+
+#include <utility>
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include "stagehand/world.h"
+
+namespace stagehand {
+    void FlecsQuery::setup(FlecsWorld *p_owner, flecs::query<> p_query) {
+        owner = p_owner;
+        query = std::move(p_query);
+        owner->live_queries.insert(this);
+    }
+
+    void FlecsQuery::release() {
+        if (owner == nullptr) {
+            return;
+        }
+
+        owner->live_queries.erase(this);
+        query.destruct();
+        query = flecs::query<>();
+        owner = nullptr;
+    }
+
+    int8_t FlecsQuery::find_field_index(flecs::entity_t component_id) const {
+        const ecs_query_t *query_ptr = query.c_ptr();
+        for (int8_t term_index = 0; term_index < query_ptr->term_count; ++term_index) {
+            const ecs_term_t &term = query_ptr->terms[term_index];
+            // Optional and negated terms may not provide data for every matched entity, and filter terms ([none]) provide no data at all,
+            // so neither can back a column.
+            if (term.id == component_id && term.oper == EcsAnd && term.inout != EcsInOutNone) {
+                return term.field_index;
+            }
+        }
+        return -1;
+    }
+
+    int64_t FlecsQuery::count() const {
+        if (unlikely(!is_valid())) {
+            godot::UtilityFunctions::push_warning("FlecsQuery::count called on an invalid query");
+            return 0;
+        }
+        owner->wait_for_simulation();
+        return query.count();
+    }
+
+    godot::PackedInt64Array FlecsQuery::entities() const {
+        godot::PackedInt64Array entity_ids;
+        if (unlikely(!is_valid())) {
+            godot::UtilityFunctions::push_warning("FlecsQuery::entities called on an invalid query");
+            return entity_ids;
+        }
+        owner->wait_for_simulation();
+
+        // One pass that grows the array with each table, like the column getters; packed arrays reserve capacity in powers of two.
+        int64_t offset = 0;
+        query.run([&](flecs::iter &it) {
+            while (it.next()) {
+                const int64_t table_count = it.count();
+                if (table_count == 0) {
+                    continue;
+                }
+                entity_ids.resize(offset + table_count);
+
+                int64_t *ids = entity_ids.ptrw();
+                const ecs_entity_t *table_entities = it.c_ptr()->entities;
+                for (int64_t row = 0; row < table_count; ++row) {
+                    ids[offset + row] = static_cast<int64_t>(table_entities[row]);
+                }
+                offset += table_count;
+            }
+        });
+
+        return entity_ids;
+    }
+
+    godot::Variant FlecsQuery::column(const godot::StringName &component_name) const {
+        if (unlikely(!is_valid())) {
+            godot::UtilityFunctions::push_warning("FlecsQuery::column called on an invalid query");
+            return godot::Variant();
+        }
+        owner->wait_for_simulation();
+
+        const FlecsWorld::ComponentBinding *binding = owner->find_component_binding(component_name);
+        if (unlikely(binding == nullptr || binding->column_getter == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("No column getter for component '") + component_name + "' found.");
+            return godot::Variant();
+        }
+
+        const int8_t field_index = find_field_index(binding->id);
+        if (unlikely(field_index < 0)) {
+            godot::UtilityFunctions::push_warning(godot::String("Component '") + component_name + "' is not a required term of the query.");
+            return godot::Variant();
+        }
+
+        godot::PackedInt64Array entity_ids;
+        return binding->column_getter(query, field_index, entity_ids);
+    }
+
+    bool FlecsQuery::changed() const {
+        if (unlikely(!is_valid())) {
+            godot::UtilityFunctions::push_warning("FlecsQuery::changed called on an invalid query");
+            return false;
+        }
+        owner->wait_for_simulation();
+        return query.changed();
+    }
+
+    FlecsQuery::~FlecsQuery() { release(); }
+
+    void FlecsQuery::_bind_methods() {
+        godot::ClassDB::bind_method(godot::D_METHOD("is_valid"), &FlecsQuery::is_valid);
+        godot::ClassDB::bind_method(godot::D_METHOD("count"), &FlecsQuery::count);
+        godot::ClassDB::bind_method(godot::D_METHOD("entities"), &FlecsQuery::entities);
+        godot::ClassDB::bind_method(godot::D_METHOD("column", "component_name"), &FlecsQuery::column);
+        godot::ClassDB::bind_method(godot::D_METHOD("changed"), &FlecsQuery::changed);
+    }
+} // namespace stagehand
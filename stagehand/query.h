@@ -0,0 +1,51 @@
+#pragma once
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include "flecs.h"
+
+namespace stagehand {
+    class FlecsWorld;
+
+    /// A cached Flecs query created by FlecsWorld::create_query(), giving GDScript table-level access to ECS data.
+    /// The query is released when the FlecsQuery is freed or when its world is destroyed, whichever happens first.
+    class FlecsQuery : public godot::RefCounted {
+        GDCLASS(FlecsQuery, godot::RefCounted)
+
+        friend class FlecsWorld;
+
+      public:
+        /// Returns true while the query is usable, i.e. it was built successfully and its world still exists.
+        [[nodiscard]] bool is_valid() const { return owner != nullptr; }
+        /// Returns the number of entities currently matched by the query.
+        /// Like entities() and column(), this iterates the query, which resets the state reported by changed().
+        [[nodiscard]] int64_t count() const;
+        /// Returns the IDs of all matched entities, in table order.
+        [[nodiscard]] godot::PackedInt64Array entities() const;
+        /// Returns the values of a component for all matched entities, in the same order as entities().
+        /// @param component_name A scalar or Godot variant component that is one of the query's terms.
+        /// @return The packed array matching the component type, or an Array for types without a packed equivalent.
+        [[nodiscard]] godot::Variant column(const godot::StringName &component_name) const;
+        /// Returns true if the data matched by the query changed since it was last iterated.
+        /// Every read of the query (count(), entities() and column()) iterates it and so consumes the change state: call changed() once, before
+        /// reading, and use its result for all the reads that follow.
+        [[nodiscard]] bool changed() const;
+
+        ~FlecsQuery() override;
+
+      private:
+        FlecsWorld *owner = nullptr;
+        flecs::query<> query;
+
+        void setup(FlecsWorld *p_owner, flecs::query<> p_query);
+        void release();
+        /// Returns the field index of the query term that reads `component_id`, or -1 if no term provides its data for every match.
+        [[nodiscard]] int8_t find_field_index(flecs::entity_t component_id) const;
+
+      protected:
+        static void _bind_methods();
+    };
+} // namespace stagehand
@@ -9,13 +9,18 @@
 #include <utility>
 #include <vector>
 
+#include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/core/type_info.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 #include "flecs.h"
 
+#include "stagehand/utilities/packed_arrays.h"
+
 namespace stagehand {
     namespace internal {
         constexpr bool stagehand_auto_seed_singleton(...) { return false; }
@@ -138,17 +143,36 @@ namespace stagehand {
         }
     };
 
+    // The accessor types below are plain function pointers (not std::function) so that FlecsWorld can dispatch through them without an extra
+    // indirection. Implementations are stateless template instantiations per component type, so the caller passes in the registered name of
+    // the component for them to use in warnings.
+
     /// Function type for retrieving a component value as a Godot Variant.
-    using ComponentGetter = std::function<godot::Variant(const flecs::world &, flecs::entity_t)>;
+    using ComponentGetter = godot::Variant (*)(const flecs::world &, flecs::entity_t, const godot::StringName &component_name);
 
     /// Function type for setting a component value from a Godot Variant.
-    using ComponentSetter = std::function<void(flecs::world &, flecs::entity_t, const godot::Variant &)>;
+    using ComponentSetter = void (*)(flecs::world &, flecs::entity_t, const godot::Variant &, const godot::StringName &component_name);
+
+    /// Function type for setting one component value per entity from an Array or packed array.
+    /// Returns the number of entities that were written.
+    using ComponentBulkSetter = int64_t (*)(flecs::world &, const godot::PackedInt64Array &, const godot::Variant &, const godot::StringName &component_name);
+
+    /// Function type for checking that a bulk setter can read the values of an Array or packed array, before any entity is written.
+    using ComponentBulkValuesCheck = bool (*)(const godot::Variant &);
+
+    /// Function type for reading a whole component column from the results of a query.
+    /// Fills the entity IDs of the matched entities and returns their values as a packed array (or an Array if the type has no packed equivalent).
+    /// @param field_index The index of the query term that matches the component.
+    using ComponentColumnGetter = godot::Variant (*)(const flecs::query<> &, int8_t, godot::PackedInt64Array &);
 
     struct ComponentFunctions {
-        ComponentGetter getter;
-        ComponentSetter setter;
-        flecs::entity_t entity_id = 0; ///< Populated by register_component_with_world_name
-        std::string data_type;         ///< C++ storage type used by setter/getter plumbing
+        ComponentGetter getter = nullptr;
+        ComponentSetter setter = nullptr;
+        ComponentBulkSetter bulk_setter = nullptr;            ///< Only populated for scalar and Godot variant components
+        ComponentColumnGetter column_getter = nullptr;        ///< Only populated for scalar and Godot variant components
+        ComponentBulkValuesCheck bulk_values_check = nullptr; ///< Only populated for scalar and Godot variant components
+        flecs::entity_t entity_id = 0;                        ///< Populated by register_component_with_world_name
+        std::string data_type;                                ///< C++ storage type used by setter/getter plumbing
     };
 
     /// Returns the global map of component functions, keyed by component name.
@@ -213,13 +237,108 @@ namespace stagehand {
         }
     }
 
+    namespace internal {
+        /// Writes values[i] into component T of entity_ids[i] for every live entity, inside a single defer bracket.
+        /// Like the per-entity setter, this doesn't toggle change detection tags.
+        template <typename T, typename StorageType>
+        int64_t set_component_values(flecs::world &world, const godot::PackedInt64Array &entity_ids, const godot::Variant &values,
+                                     const godot::StringName &component_name) {
+            const int64_t value_count = packed_arrays::get_size(values);
+            if (value_count != entity_ids.size()) {
+                godot::UtilityFunctions::push_warning(godot::String("Failed to bulk set component '") + component_name + "'. Expected " +
+                                                      godot::String::num_int64(entity_ids.size()) + " values, got " +
+                                                      (value_count < 0 ? godot::Variant::get_type_name(values.get_type()) : godot::String::num_int64(value_count)));
+                return 0;
+            }
+
+            const int64_t *ids = entity_ids.ptr();
+            int64_t written_count = 0;
+
+            // Entities that already have the component are written in place; the rest are added in one batch when the defer bracket closes.
+            // A readonly world (e.g. when called from inside a system) already defers all operations.
+            const bool should_defer = !world.is_readonly();
+            if (should_defer) {
+                world.defer_begin();
+            }
+            const bool is_supported = packed_arrays::for_each_value<StorageType>(values, [&](int64_t index, const StorageType &value) {
+                const flecs::entity_t entity_id = static_cast<flecs::entity_t>(ids[index]);
+                if (unlikely(entity_id == 0 || !world.is_alive(entity_id))) {
+                    return;
+                }
+                flecs::entity entity(world, entity_id);
+                if (T *component = entity.try_get_mut<T>()) {
+                    *component = T(value);
+                    entity.modified<T>();
+                } else {
+                    entity.set<T>(T(value));
+                }
+                ++written_count;
+            });
+            if (should_defer) {
+                world.defer_end();
+            }
+
+            if (unlikely(!is_supported)) {
+                godot::UtilityFunctions::push_warning(godot::String("Failed to bulk set component '") + component_name + "'. Cannot read values from " +
+                                                      godot::Variant::get_type_name(values.get_type()));
+            } else if (unlikely(written_count < value_count)) {
+                godot::UtilityFunctions::push_warning(godot::String("Bulk set component '") + component_name + "': skipped " +
+                                                      godot::String::num_int64(value_count - written_count) + " entities that are not alive.");
+            }
+            return written_count;
+        }
+
+        /// Copies component T of every entity matched by `query` into a packed array, one table at a time, in a single pass over the query.
+        /// The arrays grow with each table; packed arrays reserve capacity in powers of two, so that doesn't copy them for every table.
+        /// Values inherited from a prefab are repeated for each instance.
+        template <typename T, typename StorageType>
+        godot::Variant get_component_values(const flecs::query<> &query, int8_t field_index, godot::PackedInt64Array &entity_ids) {
+            using PackedArray = packed_arrays::packed_array_for_t<StorageType>;
+
+            entity_ids.resize(0);
+            PackedArray values;
+            int64_t offset = 0;
+            query.run([&](flecs::iter &it) {
+                while (it.next()) {
+                    const int64_t count = it.count();
+                    if (count == 0) {
+                        continue;
+                    }
+                    entity_ids.resize(offset + count);
+                    values.resize(offset + count);
+
+                    int64_t *ids = entity_ids.ptrw();
+                    const ecs_entity_t *entities = it.c_ptr()->entities;
+                    for (int64_t row = 0; row < count; ++row) {
+                        ids[offset + row] = static_cast<int64_t>(entities[row]);
+                    }
+
+                    const flecs::field<const T> column = it.field<const T>(field_index);
+                    const bool is_shared = !it.is_self(field_index);
+                    if constexpr (std::is_same_v<PackedArray, godot::Array>) {
+                        for (int64_t row = 0; row < count; ++row) {
+                            values[offset + row] = godot::Variant(static_cast<StorageType>(column[is_shared ? 0 : row]));
+                        }
+                    } else {
+                        auto *destination = values.ptrw() + offset;
+                        for (int64_t row = 0; row < count; ++row) {
+                            destination[row] = static_cast<StorageType>(column[is_shared ? 0 : row]);
+                        }
+                    }
+                    offset += count;
+                }
+            });
+            return values;
+        }
+    } // namespace internal
+
     /// Unified component registration for scalars, vectors, and arrays.
     template <typename T, typename StorageType = T> void register_component(const std::string &name) {
         auto &registry = get_component_registry()[name];
         registry.data_type = get_registered_cpp_type_name<StorageType>();
 
         // Register Getter
-        registry.getter = [component_name = name](const flecs::world &world, flecs::entity_t entity_id) -> godot::Variant {
+        registry.getter = [](const flecs::world &world, flecs::entity_t entity_id, const godot::StringName &component_name) -> godot::Variant {
             const T *data = nullptr;
             if (entity_id == 0) {
                 data = world.try_get<T>();
@@ -244,7 +363,7 @@ namespace stagehand {
                 }
             }
             godot::UtilityFunctions::push_warning(godot::String("Get Component: Entity ") + godot::String::num_uint64(entity_id) +
-                                                  " returned empty component data for " + component_name.c_str() + ". Returning empty Variant.");
+                                                  " returned empty component data for " + component_name + ". Returning empty Variant.");
             if constexpr (IsDictionary<T>) {
                 return godot::Variant(godot::Dictionary());
             }
@@ -252,10 +371,10 @@ namespace stagehand {
         };
 
         // Register Setter
-        registry.setter = [component_name = name](flecs::world &world, flecs::entity_t entity_id, const godot::Variant &v) {
+        registry.setter = [](flecs::world &world, flecs::entity_t entity_id, const godot::Variant &v, const godot::StringName &component_name) {
             if constexpr (HasVectorValue<T>) {
                 if (v.get_type() != godot::Variant::ARRAY) {
-                    godot::UtilityFunctions::push_warning(godot::String("Failed to set component '") + component_name.c_str() + "'. Expected Array, got " +
+                    godot::UtilityFunctions::push_warning(godot::String("Failed to set component '") + component_name + "'. Expected Array, got " +
                                                           godot::Variant::get_type_name(v.get_type()));
                     return;
                 }
@@ -280,7 +399,7 @@ namespace stagehand {
                 }
             } else if constexpr (HasArrayValue<T>) {
                 if (v.get_type() != godot::Variant::ARRAY) {
-                    godot::UtilityFunctions::push_warning(godot::String("Failed to set component '") + component_name.c_str() + "'. Expected Array, got " +
+                    godot::UtilityFunctions::push_warning(godot::String("Failed to set component '") + component_name + "'. Expected Array, got " +
                                                           godot::Variant::get_type_name(v.get_type()));
                     return;
                 }
@@ -288,7 +407,7 @@ namespace stagehand {
                 using ArrType = decltype(T::value);
                 constexpr size_t N = std::tuple_size<ArrType>::value;
                 if (arr.size() != static_cast<int>(N)) {
-                    godot::UtilityFunctions::push_warning(godot::String("Failed to set component '") + component_name.c_str() + "'. Expected array size " +
+                    godot::UtilityFunctions::push_warning(godot::String("Failed to set component '") + component_name + "'. Expected array size " +
                                                           godot::String::num_int64(N) + ", got " + godot::String::num_int64(arr.size()));
                     return;
                 }
@@ -325,10 +444,17 @@ namespace stagehand {
                 } else {
                     godot::String warning_message = "Failed to set component '{0}'. Cannot convert provided data from type '{1}' to the expected type '{2}'.";
                     godot::UtilityFunctions::push_warning(warning_message.format(
-                        godot::Array::make(component_name.c_str(), godot::Variant::get_type_name(v.get_type()), godot::Variant::get_type_name(expected_type))));
+                        godot::Array::make(component_name, godot::Variant::get_type_name(v.get_type()), godot::Variant::get_type_name(expected_type))));
                 }
             }
         };
+
+        // Register Bulk Setter
+        if constexpr (!HasVectorValue<T> && !HasArrayValue<T>) {
+            registry.bulk_setter = &internal::set_component_values<T, StorageType>;
+            registry.column_getter = &internal::get_component_values<T, StorageType>;
+            registry.bulk_values_check = &packed_arrays::can_read_values<StorageType>;
+        }
     }
 
     template <typename T, typename StorageType = T> void register_component_with_world_name(flecs::world &world, const char *fallback_name) {
@@ -1,43 +1,53 @@
 #pragma once
 
 #include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <godot_cpp/core/defs.hpp>
+
+#include "flecs.h"
 
 #include "stagehand/ecs/components/event_payload.h"
 
 namespace stagehand {
-    /// Helper function to emit Godot signals from Flecs systems safely.
-    /// @param world The Flecs world.
-    /// @param payload Signal payload. source_entity_id is used as source when non-zero.
-    inline void emit_signal(const flecs::world &world, const stagehand::EventPayload &payload) {
-        stagehand::EventPayload signal = payload;
-
-        ecs_entity_t emitter_entity_id = 0;
-        if (signal.source_entity_id != 0) {
-            emitter_entity_id = static_cast<ecs_entity_t>(signal.source_entity_id);
-        } else {
-            emitter_entity_id = world.entity("stagehand::internal::no_source_event_emitter").id();
+    /// Helper function to emit Godot signals from Flecs systems safely, including from multi-threaded systems.
+    /// The payload is pushed to the calling stage's lane of the SignalQueue singleton and emitted as a Flecs event on the main thread after
+    /// OnRender, so emitting takes no lock and doesn't go through the stage's command queue.
+    /// @param world The Flecs world, or the stage a system runs on (it.world()).
+    /// @param payload Signal payload. source_entity_id is used as source when non-zero. Pass an rvalue to avoid copying the payload.
+    inline void emit_signal(const flecs::world &world, stagehand::EventPayload payload) {
+        // Go through the real world so this also works from inside systems, where `world` is a stage. The lane is picked from the stage.
+        SignalQueue *signal_queue = world.get_world().try_get_mut<SignalQueue>();
+        if (unlikely(signal_queue == nullptr)) {
+            return;
+        }
+
+        std::vector<EventPayload> *lane = signal_queue->payloads.lane(world);
+        if (likely(lane != nullptr)) {
+            lane->push_back(std::move(payload));
+            return;
         }
 
-        // Defer the emission to ensure it happens at a safe synchronization point (main thread usually)
-        world.defer(
-            [world, signal, emitter_entity_id]() { world.event<stagehand::EventPayload>().id(flecs::Any).entity(emitter_entity_id).ctx(signal).emit(); });
+        // The stage was created after the queue was last prepared (threads were changed on the flecs::world directly); emit right away instead.
+        const ecs_entity_t emitter_entity_id = payload.source_entity_id != 0 ? static_cast<ecs_entity_t>(payload.source_entity_id) : signal_queue->no_source_emitter;
+        world.event<stagehand::EventPayload>().id(flecs::Any).entity(emitter_entity_id).ctx(payload).emit();
     }
 
     /// Emits a signal using an entity as source.
     /// @param source_entity The entity emitting the signal.
     /// @param payload Signal payload. source_entity_id is populated from source_entity when missing.
-    inline void emit_signal(const flecs::entity &source_entity, const stagehand::EventPayload &payload) {
-        stagehand::EventPayload payload_with_source = payload;
-        if (payload_with_source.source_entity_id == 0) {
-            payload_with_source.source_entity_id = static_cast<uint64_t>(source_entity.id());
+    inline void emit_signal(const flecs::entity &source_entity, stagehand::EventPayload payload) {
+        if (payload.source_entity_id == 0) {
+            payload.source_entity_id = static_cast<uint64_t>(source_entity.id());
         }
 
-        emit_signal(source_entity.world(), payload_with_source);
+        emit_signal(source_entity.world(), std::move(payload));
     }
 
     /// Emits a signal using the entity at an iterator row as source.
     /// @param it Flecs iterator.
     /// @param index Row index in the iterator.
     /// @param payload Signal payload.
-    inline void emit_signal(const flecs::iter &it, const size_t index, const stagehand::EventPayload &payload) { emit_signal(it.entity(index), payload); }
+    inline void emit_signal(const flecs::iter &it, const size_t index, stagehand::EventPayload payload) { emit_signal(it.entity(index), std::move(payload)); }
 } // namespace stagehand
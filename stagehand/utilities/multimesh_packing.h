@@ -0,0 +1,410 @@
+/// Packing of entity data into MultiMesh buffers, for the Entity Rendering (MultiMesh) system.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/plane.hpp>
+#include <godot_cpp/variant/rect2.hpp>
+#include <godot_cpp/variant/transform2d.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+
+#include "stagehand/ecs/components/interpolation.h"
+#include "stagehand/ecs/components/rendering.h"
+#include "stagehand/ecs/components/transform.h"
+#include "stagehand/utilities/parallel_ranges.h"
+#include "stagehand/utilities/render_transform_layout.h"
+
+// Buffer format: https://docs.godotengine.org/en/stable/classes/class_renderingserver.html#class-renderingserver-method-multimesh-set-buffer
+// The per - instance data size and expected data order is :
+// 2D :
+//     - Position : 8 floats(8 floats for Transform2D)
+//     - Position + Vertex color : 12 floats(8 floats for Transform2D, 4 floats for Color)
+//     - Position + Custom data : 12 floats(8 floats for Transform2D, 4 floats of custom data)
+//     - Position + Vertex color + Custom data : 16 floats(8 floats for Transform2D, 4 floats for Color, 4 floats of custom data)
+// 3D :
+//     - Position : 12 floats(12 floats for Transform3D)
+//     - Position + Vertex color : 16 floats(12 floats for Transform3D, 4 floats for Color)
+//     - Position + Custom data : 16 floats(12 floats for Transform3D, 4 floats of custom data)
+//     - Position + Vertex color + Custom data : 20 floats(12 floats for Transform3D, 4 floats for Color, 4 floats of custom data)
+//
+// Instance transforms are in row - major order.Specifically:
+// For Transform2D the float - order is : (x.x, y.x, padding_float, origin.x, x.y, y.y, padding_float, origin.y).
+// For Transform3D the float - order is : (basis.x.x, basis.y.x, basis.z.x, origin.x, basis.x.y, basis.y.y, basis.z.y, origin.y, basis.x.z, basis.y.z,
+// basis.z.z, origin.z).
+
+namespace stagehand::rendering {
+    /// Fewest instances worth handing to another thread. Below that, waking a worker costs more than packing the instances.
+    constexpr uint32_t MIN_INSTANCES_PER_PACKING_JOB = 2048;
+
+    /// Most changed instances sent one by one by a renderer with incremental updates. Each one costs a RenderingServer call per buffer
+    /// part (transform, color and custom data), so past this, or past an eighth of the instances, a full upload is cheaper.
+    constexpr uint32_t MAX_INCREMENTAL_UPLOAD_INSTANCES = 4096;
+
+    /// How the Entity Rendering (MultiMesh) system sends a renderer's instances to the RenderingServer this frame.
+    enum class MultiMeshUpload {
+        /// Nothing changed since the last upload.
+        None,
+        /// Only the changed instances, one by one.
+        Instances,
+        /// The whole buffer.
+        Full,
+    };
+
+    /// Picks the upload of a renderer with incremental updates. `layout_unchanged` tells whether every instance is in the same place in the
+    /// buffer as in the last upload, which the changed instances alone can't be sent without.
+    [[nodiscard]] constexpr MultiMeshUpload choose_multimesh_upload(bool layout_unchanged, uint32_t dirty_instance_count, uint32_t instance_count) {
+        if (!layout_unchanged) {
+            return MultiMeshUpload::Full;
+        }
+        if (dirty_instance_count == 0) {
+            return MultiMeshUpload::None;
+        }
+        if (dirty_instance_count > MAX_INCREMENTAL_UPLOAD_INSTANCES || dirty_instance_count > instance_count / 8) {
+            return MultiMeshUpload::Full;
+        }
+        return MultiMeshUpload::Instances;
+    }
+
+    /// The stagehand transform component that the RenderTransform2D/3D of an entity is composed from, for a Godot transform type.
+    template <typename TransformType>
+    using TransformComponentFor = std::conditional_t<std::is_same_v<TransformType, Transform2D>, transform::Transform2D, transform::Transform3D>;
+
+    /// The instances of one query result (a table, or part of one when the query is sorted) and where they go in the buffer.
+    /// Columns the renderer doesn't use are null.
+    template <typename TransformType> struct MultiMeshPackSlice {
+        /// Exactly one of `transforms` and `render_transforms` is set.
+        const TransformType *transforms = nullptr;
+        /// For tables with RenderTransform2D/3D instead of a Godot transform: the transforms, already in buffer layout.
+        const float *render_transforms = nullptr;
+        /// Only set while interpolating, for tables that have Previous<TransformType>.
+        const interpolation::Previous<TransformType> *previous_transforms = nullptr;
+        /// Only set while interpolating, for tables of render transforms that have the transform component they are composed from and its
+        /// Previous. Those instances are blended from these instead of copied from `render_transforms`.
+        const TransformComponentFor<TransformType> *component_transforms = nullptr;
+        const interpolation::Previous<TransformComponentFor<TransformType>> *previous_component_transforms = nullptr;
+        const Color *colors = nullptr;
+        const CustomData *custom_data = nullptr;
+        /// Index of the first instance of the slice in the buffer.
+        uint32_t first_instance = 0;
+        uint32_t count = 0;
+    };
+
+    template <typename TransformType> [[nodiscard]] constexpr uint32_t get_floats_per_instance(bool use_colors, bool use_custom_data) {
+        constexpr uint32_t transform_floats = std::is_same_v<TransformType, Transform2D> ? 8 : 12;
+        return transform_floats + (use_colors ? 4 : 0) + (use_custom_data ? 4 : 0);
+    }
+
+    /// What a culling renderer can see this frame, in its local space, which is the space of the instance transforms.
+    /// Instances are culled by their origin, so `margin` is how far outside the volume an origin can be while part of the mesh may still
+    /// be visible: at least the radius of the mesh.
+    struct MultiMeshCullVolume {
+        /// 2D: the visible part of the canvas.
+        Rect2 rect;
+        /// 3D: the planes of the camera frustum, with their normals pointing out of it.
+        std::array<Plane, 6> planes;
+        float margin = 0.0f;
+    };
+
+    /// Returns whether instance `index` of `slice` may be visible. Interpolated instances are tested at their current transform, which the
+    /// margin covers for anything that moves less than it in a tick.
+    template <typename TransformType>
+    [[nodiscard]] inline bool is_multimesh_instance_visible(const MultiMeshCullVolume &volume, const MultiMeshPackSlice<TransformType> &slice, uint32_t index) {
+        if constexpr (std::is_same_v<TransformType, Transform2D>) {
+            Vector2 origin;
+            if (slice.transforms != nullptr) {
+                origin = slice.transforms[index].columns[2];
+            } else {
+                const float *render_transform = slice.render_transforms + size_t{index} * 8;
+                origin = Vector2(render_transform[3], render_transform[7]);
+            }
+            const Vector2 &start = volume.rect.position;
+            const Vector2 end = volume.rect.get_end();
+            return origin.x >= start.x - volume.margin && origin.x <= end.x + volume.margin && origin.y >= start.y - volume.margin &&
+                   origin.y <= end.y + volume.margin;
+        } else {
+            Vector3 origin;
+            if (slice.transforms != nullptr) {
+                origin = slice.transforms[index].origin;
+            } else {
+                const float *render_transform = slice.render_transforms + size_t{index} * 12;
+                origin = Vector3(render_transform[3], render_transform[7], render_transform[11]);
+            }
+            for (const Plane &plane : volume.planes) {
+                if (plane.distance_to(origin) > volume.margin) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /// Returns the transform column of a slice, whichever kind it is. The column and the size of each slice identify the buffer layout.
+    template <typename TransformType> [[nodiscard]] inline const void *get_transform_column(const MultiMeshPackSlice<TransformType> &slice) {
+        return slice.transforms != nullptr ? static_cast<const void *>(slice.transforms) : static_cast<const void *>(slice.render_transforms);
+    }
+
+    /// Writes instance `index` of `slice` to `output`, which points at the instance's floats_per_instance floats in the buffer.
+    /// The reference for the layout: the kernels returned by get_multimesh_pack_kernel() write the same floats.
+    template <typename TransformType>
+    inline void pack_multimesh_instance(const MultiMeshPackSlice<TransformType> &slice, uint32_t index, float interpolation_alpha, float *output) {
+        constexpr uint32_t transform_floats = get_floats_per_instance<TransformType>(false, false);
+        uint32_t cursor = 0;
+        if (slice.previous_component_transforms != nullptr) {
+            const TransformComponentFor<TransformType> transform =
+                interpolation::interpolate(slice.previous_component_transforms[index], slice.component_transforms[index], interpolation_alpha);
+            pack_render_transform(transform, output);
+            cursor = transform_floats;
+        } else if (slice.render_transforms != nullptr) {
+            std::memcpy(output, slice.render_transforms + size_t{index} * transform_floats, transform_floats * sizeof(float));
+            cursor = transform_floats;
+        } else if constexpr (std::is_same_v<TransformType, Transform2D>) {
+            const Transform2D transform = slice.previous_transforms != nullptr
+                                              ? interpolation::interpolate(slice.previous_transforms[index], slice.transforms[index], interpolation_alpha)
+                                              : slice.transforms[index];
+            output[cursor++] = transform.columns[0].x;
+            output[cursor++] = transform.columns[1].x;
+            output[cursor++] = 0.0f;
+            output[cursor++] = transform.columns[2].x;
+            output[cursor++] = transform.columns[0].y;
+            output[cursor++] = transform.columns[1].y;
+            output[cursor++] = 0.0f;
+            output[cursor++] = transform.columns[2].y;
+        } else if constexpr (std::is_same_v<TransformType, Transform3D>) {
+            const Transform3D transform = slice.previous_transforms != nullptr
+                                              ? interpolation::interpolate(slice.previous_transforms[index], slice.transforms[index], interpolation_alpha)
+                                              : slice.transforms[index];
+            // RenderingServer expects Transform3D data as the rows of the 3x4 matrix, each followed by the matching origin component.
+            const Vector3 &row0 = transform.basis.rows[0];
+            const Vector3 &row1 = transform.basis.rows[1];
+            const Vector3 &row2 = transform.basis.rows[2];
+
+            output[cursor++] = row0.x;
+            output[cursor++] = row0.y;
+            output[cursor++] = row0.z;
+            output[cursor++] = transform.origin.x;
+
+            output[cursor++] = row1.x;
+            output[cursor++] = row1.y;
+            output[cursor++] = row1.z;
+            output[cursor++] = transform.origin.y;
+
+            output[cursor++] = row2.x;
+            output[cursor++] = row2.y;
+            output[cursor++] = row2.z;
+            output[cursor++] = transform.origin.z;
+        }
+
+        if (slice.colors != nullptr) {
+            const Color &color = slice.colors[index];
+            output[cursor++] = color.r;
+            output[cursor++] = color.g;
+            output[cursor++] = color.b;
+            output[cursor++] = color.a;
+        }
+        if (slice.custom_data != nullptr) {
+            const CustomData &custom_data = slice.custom_data[index];
+            output[cursor++] = custom_data.x;
+            output[cursor++] = custom_data.y;
+            output[cursor++] = custom_data.z;
+            output[cursor++] = custom_data.w;
+        }
+    }
+
+    namespace internal {
+#if STAGEHAND_MULTIMESH_SIMD
+        static_assert(sizeof(CustomData) == 4 * sizeof(float), "CustomData is expected to be four floats");
+
+        inline void pack_vector4(const float *source, float *output) { _mm_storeu_ps(output, _mm_loadu_ps(source)); }
+#else
+        template <typename Source> inline void pack_vector4(const Source *source, float *output) {
+            for (int i = 0; i < 4; ++i) {
+                output[i] = static_cast<float>(source[i]);
+            }
+        }
+#endif
+
+        /// Packs the color and custom data of instance `i` after its transform, at `output`, as far as the format has them.
+        template <typename TransformType, bool UseColors, bool UseCustomData>
+        inline void pack_instance_extras(const Color *colors, const CustomData *custom_data, uint32_t i, float *output) {
+            constexpr uint32_t transform_floats = get_floats_per_instance<TransformType>(false, false);
+            if constexpr (UseColors) {
+                pack_vector4(&colors[i].r, output + transform_floats);
+            }
+            if constexpr (UseCustomData) {
+                pack_vector4(&custom_data[i].x, output + transform_floats + (UseColors ? 4 : 0));
+            }
+        }
+
+        /// Packs instances [begin, end) of `slice` to `output`, which points at instance `begin`. The format is fixed at compile time, so the
+        /// loop has no per-instance branches and each column pointer is read once. Render transforms are copied as is, unless they are
+        /// blended from their previous transform: a slice of them is a single copy when the format has no colors or custom data.
+        template <typename TransformType, bool UseColors, bool UseCustomData>
+        void pack_multimesh_instances(const MultiMeshPackSlice<TransformType> &slice, uint32_t begin, uint32_t end, float interpolation_alpha,
+                                      float *output) {
+            constexpr uint32_t floats_per_instance = get_floats_per_instance<TransformType>(UseColors, UseCustomData);
+            constexpr uint32_t transform_floats = get_floats_per_instance<TransformType>(false, false);
+            const Color *colors = UseColors ? slice.colors + begin : nullptr;
+            const CustomData *custom_data = UseCustomData ? slice.custom_data + begin : nullptr;
+            const uint32_t count = end - begin;
+
+            if (slice.previous_component_transforms != nullptr) {
+                const TransformComponentFor<TransformType> *transforms = slice.component_transforms + begin;
+                const interpolation::Previous<TransformComponentFor<TransformType>> *previous_transforms = slice.previous_component_transforms + begin;
+                for (uint32_t i = 0; i < count; ++i, output += floats_per_instance) {
+                    pack_render_transform(interpolation::interpolate(previous_transforms[i], transforms[i], interpolation_alpha), output);
+                    pack_instance_extras<TransformType, UseColors, UseCustomData>(colors, custom_data, i, output);
+                }
+                return;
+            }
+
+            if (slice.render_transforms != nullptr) {
+                const float *render_transforms = slice.render_transforms + size_t{begin} * transform_floats;
+                if constexpr (!UseColors && !UseCustomData) {
+                    // The buffer holds nothing but the transforms, which are already in its layout.
+                    std::memcpy(output, render_transforms, size_t{count} * transform_floats * sizeof(float));
+                    return;
+                }
+                for (uint32_t i = 0; i < count; ++i, output += floats_per_instance, render_transforms += transform_floats) {
+                    std::memcpy(output, render_transforms, transform_floats * sizeof(float));
+                    pack_instance_extras<TransformType, UseColors, UseCustomData>(colors, custom_data, i, output);
+                }
+                return;
+            }
+
+            const TransformType *transforms = slice.transforms + begin;
+            const interpolation::Previous<TransformType> *previous_transforms =
+                slice.previous_transforms != nullptr ? slice.previous_transforms + begin : nullptr;
+            for (uint32_t i = 0; i < count; ++i, output += floats_per_instance) {
+                if (previous_transforms != nullptr) {
+                    pack_render_transform(interpolation::interpolate(previous_transforms[i], transforms[i], interpolation_alpha), output);
+                } else {
+                    pack_render_transform(transforms[i], output);
+                }
+                pack_instance_extras<TransformType, UseColors, UseCustomData>(colors, custom_data, i, output);
+            }
+        }
+    } // namespace internal
+
+    /// Packs instances [begin, end) of a slice to the buffer position of instance `begin`.
+    template <typename TransformType>
+    using MultiMeshPackKernel = void (*)(const MultiMeshPackSlice<TransformType> &slice, uint32_t begin, uint32_t end, float interpolation_alpha,
+                                         float *output);
+
+    /// Returns the packing kernel for a renderer's format. Slices packed with it must have the columns the format uses.
+    template <typename TransformType> [[nodiscard]] MultiMeshPackKernel<TransformType> get_multimesh_pack_kernel(bool use_colors, bool use_custom_data) {
+        if (use_colors) {
+            return use_custom_data ? &internal::pack_multimesh_instances<TransformType, true, true>
+                                   : &internal::pack_multimesh_instances<TransformType, true, false>;
+        }
+        return use_custom_data ? &internal::pack_multimesh_instances<TransformType, false, true>
+                               : &internal::pack_multimesh_instances<TransformType, false, false>;
+    }
+
+    /// Calls body(slice, slice_begin, slice_end) for the part of each slice within the instances [begin, end), in order, with the bounds
+    /// relative to the slice. `slices` are sorted by first_instance and cover the instances without gaps.
+    template <typename TransformType, typename Body>
+    void for_each_slice_range(const std::vector<MultiMeshPackSlice<TransformType>> &slices, uint32_t begin, uint32_t end, const Body &body) {
+        // The last slice starting at or before `begin`.
+        auto slice = std::upper_bound(slices.begin(), slices.end(), begin,
+                                      [](uint32_t instance, const MultiMeshPackSlice<TransformType> &s) { return instance < s.first_instance; });
+        if (slice == slices.begin()) {
+            return;
+        }
+        --slice;
+
+        uint32_t instance = begin;
+        for (; slice != slices.end() && instance < end; ++slice) {
+            const uint32_t slice_end = std::min(end, slice->first_instance + slice->count);
+            if (instance < slice_end) {
+                body(*slice, instance - slice->first_instance, slice_end - slice->first_instance);
+                instance = slice_end;
+            }
+        }
+    }
+
+    /// Packs the instances in [begin, end) of the buffer. `slices` are sorted by first_instance and cover the buffer without gaps.
+    template <typename TransformType>
+    void pack_multimesh_range(const std::vector<MultiMeshPackSlice<TransformType>> &slices, uint32_t begin, uint32_t end,
+                              MultiMeshPackKernel<TransformType> kernel, uint32_t floats_per_instance, float interpolation_alpha, float *buffer) {
+        for_each_slice_range(slices, begin, end, [&](const MultiMeshPackSlice<TransformType> &slice, uint32_t slice_begin, uint32_t slice_end) {
+            kernel(slice, slice_begin, slice_end, interpolation_alpha, buffer + size_t{slice.first_instance + slice_begin} * floats_per_instance);
+        });
+    }
+
+    /// Packs the first `instance_count` instances of `slices` into `buffer`, in the format of a renderer using colors and custom data as
+    /// given. Large buffers are split into equal ranges packed on up to `worker_count` threads; each range writes to its own part of the
+    /// buffer, so they need no synchronisation.
+    template <typename TransformType>
+    void pack_multimesh_slices(const std::vector<MultiMeshPackSlice<TransformType>> &slices, uint32_t instance_count, bool use_colors, bool use_custom_data,
+                               float interpolation_alpha, int32_t worker_count, float *buffer) {
+        const MultiMeshPackKernel<TransformType> kernel = get_multimesh_pack_kernel<TransformType>(use_colors, use_custom_data);
+        const uint32_t floats_per_instance = get_floats_per_instance<TransformType>(use_colors, use_custom_data);
+        const int32_t job_count = std::clamp(static_cast<int32_t>(instance_count / MIN_INSTANCES_PER_PACKING_JOB), 1, std::max(worker_count, 1));
+        run_parallel_ranges(static_cast<int32_t>(instance_count), job_count, [&](int32_t begin, int32_t end) {
+            pack_multimesh_range(slices, static_cast<uint32_t>(begin), static_cast<uint32_t>(end), kernel, floats_per_instance, interpolation_alpha, buffer);
+        });
+    }
+
+    /// Like pack_multimesh_slices(), but only packs the instances that may be visible in `cull_volume`, back to back from the start of the
+    /// buffer, and returns how many there are. The instances are split into ranges as for packing; each range counts its visible instances,
+    /// then packs them after those of the ranges before it, a run of consecutive visible instances at a time.
+    template <typename TransformType>
+    [[nodiscard]] uint32_t pack_visible_multimesh_slices(const std::vector<MultiMeshPackSlice<TransformType>> &slices, uint32_t instance_count, bool use_colors,
+                                                         bool use_custom_data, const MultiMeshCullVolume &cull_volume, float interpolation_alpha,
+                                                         int32_t worker_count, float *buffer) {
+        const MultiMeshPackKernel<TransformType> kernel = get_multimesh_pack_kernel<TransformType>(use_colors, use_custom_data);
+        const uint32_t floats_per_instance = get_floats_per_instance<TransformType>(use_colors, use_custom_data);
+        const int32_t job_count = std::clamp(static_cast<int32_t>(instance_count / MIN_INSTANCES_PER_PACKING_JOB), 1, std::max(worker_count, 1));
+        const auto job_begin = [instance_count, job_count](int32_t job) {
+            return static_cast<uint32_t>(uint64_t{instance_count} * static_cast<uint64_t>(job) / static_cast<uint64_t>(job_count));
+        };
+
+        // Every job has a range of its own, so each index of run_parallel_ranges() is a job.
+        std::vector<uint32_t> first_visible(static_cast<size_t>(job_count) + 1, 0);
+        run_parallel_ranges(job_count, job_count, [&](int32_t first_job, int32_t end_job) {
+            for (int32_t job = first_job; job < end_job; ++job) {
+                uint32_t visible = 0;
+                for_each_slice_range(slices, job_begin(job), job_begin(job + 1),
+                                     [&](const MultiMeshPackSlice<TransformType> &slice, uint32_t slice_begin, uint32_t slice_end) {
+                                         for (uint32_t i = slice_begin; i < slice_end; ++i) {
+                                             visible += is_multimesh_instance_visible(cull_volume, slice, i) ? 1 : 0;
+                                         }
+                                     });
+                first_visible[static_cast<size_t>(job) + 1] = visible;
+            }
+        });
+        for (size_t job = 1; job < first_visible.size(); ++job) {
+            first_visible[job] += first_visible[job - 1];
+        }
+
+        run_parallel_ranges(job_count, job_count, [&](int32_t first_job, int32_t end_job) {
+            for (int32_t job = first_job; job < end_job; ++job) {
+                float *output = buffer + size_t{first_visible[static_cast<size_t>(job)]} * floats_per_instance;
+                for_each_slice_range(slices, job_begin(job), job_begin(job + 1),
+                                     [&](const MultiMeshPackSlice<TransformType> &slice, uint32_t slice_begin, uint32_t slice_end) {
+                                         uint32_t i = slice_begin;
+                                         while (i < slice_end) {
+                                             while (i < slice_end && !is_multimesh_instance_visible(cull_volume, slice, i)) {
+                                                 ++i;
+                                             }
+                                             const uint32_t run_begin = i;
+                                             while (i < slice_end && is_multimesh_instance_visible(cull_volume, slice, i)) {
+                                                 ++i;
+                                             }
+                                             if (run_begin < i) {
+                                                 kernel(slice, run_begin, i, interpolation_alpha, output);
+                                                 output += size_t{i - run_begin} * floats_per_instance;
+                                             }
+                                         }
+                                     });
+            }
+        });
+        return first_visible.back();
+    }
+} // namespace stagehand::rendering
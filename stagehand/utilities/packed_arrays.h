@@ -0,0 +1,225 @@
+/// Helpers for moving component data in and out of Godot packed arrays without per-element Variant round-trips.
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_color_array.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_float64_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+#include <godot_cpp/variant/packed_vector4_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/variant.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <godot_cpp/variant/vector4.hpp>
+
+namespace stagehand::packed_arrays {
+    /// Maps a component storage type to the Godot packed array that holds it without boxing each element in a Variant.
+    /// Storage types without a dedicated packed array fall back to a generic godot::Array.
+    template <typename StorageType> struct packed_array_for {
+        using type = godot::Array;
+    };
+    template <> struct packed_array_for<float> {
+        using type = godot::PackedFloat32Array;
+    };
+    template <> struct packed_array_for<double> {
+        using type = godot::PackedFloat64Array;
+    };
+    template <> struct packed_array_for<std::uint8_t> {
+        using type = godot::PackedByteArray;
+    };
+    template <> struct packed_array_for<std::int8_t> {
+        using type = godot::PackedInt32Array;
+    };
+    template <> struct packed_array_for<std::int16_t> {
+        using type = godot::PackedInt32Array;
+    };
+    template <> struct packed_array_for<std::uint16_t> {
+        using type = godot::PackedInt32Array;
+    };
+    template <> struct packed_array_for<std::int32_t> {
+        using type = godot::PackedInt32Array;
+    };
+    template <> struct packed_array_for<std::uint32_t> {
+        using type = godot::PackedInt64Array;
+    };
+    template <> struct packed_array_for<std::int64_t> {
+        using type = godot::PackedInt64Array;
+    };
+    template <> struct packed_array_for<std::uint64_t> {
+        using type = godot::PackedInt64Array;
+    };
+    template <> struct packed_array_for<godot::Vector2> {
+        using type = godot::PackedVector2Array;
+    };
+    template <> struct packed_array_for<godot::Vector3> {
+        using type = godot::PackedVector3Array;
+    };
+    template <> struct packed_array_for<godot::Vector4> {
+        using type = godot::PackedVector4Array;
+    };
+    template <> struct packed_array_for<godot::Color> {
+        using type = godot::PackedColorArray;
+    };
+    template <> struct packed_array_for<godot::String> {
+        using type = godot::PackedStringArray;
+    };
+
+    template <typename StorageType> using packed_array_for_t = typename packed_array_for<StorageType>::type;
+
+    /// Returns the element count of an Array or packed array Variant, or -1 if the Variant is not an array.
+    [[nodiscard]] inline int64_t get_size(const godot::Variant &values) {
+        switch (values.get_type()) {
+        case godot::Variant::ARRAY:
+            return static_cast<godot::Array>(values).size();
+        case godot::Variant::PACKED_BYTE_ARRAY:
+            return static_cast<godot::PackedByteArray>(values).size();
+        case godot::Variant::PACKED_INT32_ARRAY:
+            return static_cast<godot::PackedInt32Array>(values).size();
+        case godot::Variant::PACKED_INT64_ARRAY:
+            return static_cast<godot::PackedInt64Array>(values).size();
+        case godot::Variant::PACKED_FLOAT32_ARRAY:
+            return static_cast<godot::PackedFloat32Array>(values).size();
+        case godot::Variant::PACKED_FLOAT64_ARRAY:
+            return static_cast<godot::PackedFloat64Array>(values).size();
+        case godot::Variant::PACKED_STRING_ARRAY:
+            return static_cast<godot::PackedStringArray>(values).size();
+        case godot::Variant::PACKED_VECTOR2_ARRAY:
+            return static_cast<godot::PackedVector2Array>(values).size();
+        case godot::Variant::PACKED_VECTOR3_ARRAY:
+            return static_cast<godot::PackedVector3Array>(values).size();
+        case godot::Variant::PACKED_COLOR_ARRAY:
+            return static_cast<godot::PackedColorArray>(values).size();
+        case godot::Variant::PACKED_VECTOR4_ARRAY:
+            return static_cast<godot::PackedVector4Array>(values).size();
+        default:
+            return -1;
+        }
+    }
+
+    /// Returns whether for_each_value<StorageType>() can read `values`, without reading them.
+    template <typename StorageType> [[nodiscard]] bool can_read_values(const godot::Variant &values) {
+        switch (values.get_type()) {
+        case godot::Variant::ARRAY:
+            return true;
+        case godot::Variant::PACKED_BYTE_ARRAY:
+        case godot::Variant::PACKED_INT32_ARRAY:
+        case godot::Variant::PACKED_INT64_ARRAY:
+        case godot::Variant::PACKED_FLOAT32_ARRAY:
+        case godot::Variant::PACKED_FLOAT64_ARRAY:
+            return std::is_arithmetic_v<StorageType>;
+        case godot::Variant::PACKED_STRING_ARRAY:
+            return std::is_same_v<StorageType, godot::String>;
+        case godot::Variant::PACKED_VECTOR2_ARRAY:
+            return std::is_same_v<StorageType, godot::Vector2>;
+        case godot::Variant::PACKED_VECTOR3_ARRAY:
+            return std::is_same_v<StorageType, godot::Vector3>;
+        case godot::Variant::PACKED_COLOR_ARRAY:
+            return std::is_same_v<StorageType, godot::Color>;
+        case godot::Variant::PACKED_VECTOR4_ARRAY:
+            return std::is_same_v<StorageType, godot::Vector4>;
+        default:
+            return false;
+        }
+    }
+
+    namespace internal {
+        template <typename StorageType, typename PackedArray, typename Callback> void visit_packed(const PackedArray &packed, Callback &callback) {
+            const int64_t count = packed.size();
+            const auto *data = packed.ptr();
+            for (int64_t index = 0; index < count; ++index) {
+                callback(index, static_cast<StorageType>(data[index]));
+            }
+        }
+    } // namespace internal
+
+    /// Invokes callback(index, value) for every element of `values`, converted to StorageType.
+    /// Arithmetic storage types accept any numeric packed array; Godot math types accept their matching packed array.
+    /// A generic Array is accepted for every storage type and converted element by element.
+    /// @return false (without invoking the callback) if `values` cannot provide StorageType elements.
+    template <typename StorageType, typename Callback> bool for_each_value(const godot::Variant &values, Callback &&callback) {
+        constexpr bool is_numeric = std::is_arithmetic_v<StorageType>;
+
+        switch (values.get_type()) {
+        case godot::Variant::ARRAY: {
+            const godot::Array array = values;
+            const int64_t count = array.size();
+            for (int64_t index = 0; index < count; ++index) {
+                callback(index, static_cast<StorageType>(array[index]));
+            }
+            return true;
+        }
+        case godot::Variant::PACKED_BYTE_ARRAY:
+            if constexpr (is_numeric) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedByteArray>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_INT32_ARRAY:
+            if constexpr (is_numeric) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedInt32Array>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_INT64_ARRAY:
+            if constexpr (is_numeric) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedInt64Array>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_FLOAT32_ARRAY:
+            if constexpr (is_numeric) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedFloat32Array>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_FLOAT64_ARRAY:
+            if constexpr (is_numeric) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedFloat64Array>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_STRING_ARRAY:
+            if constexpr (std::is_same_v<StorageType, godot::String>) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedStringArray>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_VECTOR2_ARRAY:
+            if constexpr (std::is_same_v<StorageType, godot::Vector2>) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedVector2Array>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_VECTOR3_ARRAY:
+            if constexpr (std::is_same_v<StorageType, godot::Vector3>) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedVector3Array>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_COLOR_ARRAY:
+            if constexpr (std::is_same_v<StorageType, godot::Color>) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedColorArray>(values), callback);
+                return true;
+            }
+            return false;
+        case godot::Variant::PACKED_VECTOR4_ARRAY:
+            if constexpr (std::is_same_v<StorageType, godot::Vector4>) {
+                internal::visit_packed<StorageType>(static_cast<godot::PackedVector4Array>(values), callback);
+                return true;
+            }
+            return false;
+        default:
+            return false;
+        }
+    }
+} // namespace stagehand::packed_arrays
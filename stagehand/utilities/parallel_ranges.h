@@ -0,0 +1,66 @@
+/// Blocking fork-join over the Flecs task threads, for systems that split up their own work (e.g. filling a MultiMesh buffer).
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "flecs.h"
+
+#include "stagehand/utilities/worker_thread_pool_tasks.h"
+
+namespace stagehand {
+    /// Calls body(begin, end) for `job_count` consecutive, disjoint ranges that together cover [0, count), and returns once they all have run.
+    /// The calling thread runs the first range, the others run as Flecs tasks (Godot's WorkerThreadPool inside the engine). Without task
+    /// support, or with a single job, the whole range runs on the calling thread.
+    /// On the WorkerThreadPool, the jobs only get the pool threads nobody has claimed (see WorkerThreadPoolTasks::claim_jobs()): the world's
+    /// own workers hold theirs while they wait for the calling system, so a job queued behind them would never start. With no thread
+    /// free, the whole range runs on the calling thread.
+    /// `body` is called concurrently, so the ranges must not write to shared data, and must not use the world.
+    template <typename Body> void run_parallel_ranges(int32_t count, int32_t job_count, const Body &body) {
+        if (count <= 0) {
+            return;
+        }
+        job_count = std::min(job_count, count);
+        if (job_count <= 1 || !ecs_os_has_task_support()) {
+            body(int32_t{0}, count);
+            return;
+        }
+        int32_t claimed_jobs = 0;
+        if (::utilities::WorkerThreadPoolTasks::is_installed()) {
+            claimed_jobs = ::utilities::WorkerThreadPoolTasks::claim_jobs(job_count - 1);
+            job_count = claimed_jobs + 1;
+            if (job_count <= 1) {
+                body(int32_t{0}, count);
+                return;
+            }
+        }
+
+        struct Job {
+            const Body *body = nullptr;
+            int32_t begin = 0;
+            int32_t end = 0;
+        };
+        std::vector<Job> jobs(static_cast<size_t>(job_count));
+        for (int32_t job = 0; job < job_count; ++job) {
+            jobs[static_cast<size_t>(job)] = {&body, static_cast<int32_t>(int64_t{count} * job / job_count),
+                                              static_cast<int32_t>(int64_t{count} * (job + 1) / job_count)};
+        }
+
+        const ecs_os_thread_callback_t run_job = [](void *param) -> void * {
+            const Job *job = static_cast<const Job *>(param);
+            (*job->body)(job->begin, job->end);
+            return nullptr;
+        };
+        std::vector<ecs_os_thread_t> threads;
+        threads.reserve(jobs.size() - 1);
+        for (size_t job = 1; job < jobs.size(); ++job) {
+            threads.push_back(ecs_os_task_new(run_job, &jobs[job]));
+        }
+        run_job(&jobs[0]);
+        for (ecs_os_thread_t thread : threads) {
+            ecs_os_task_join(thread);
+        }
+        ::utilities::WorkerThreadPoolTasks::release_jobs(claimed_jobs);
+    }
+} // namespace stagehand
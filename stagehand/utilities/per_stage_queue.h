@@ -0,0 +1,75 @@
+/// Append-only queue with one lane per Flecs stage, so systems running on several worker threads can push without locks.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <godot_cpp/core/defs.hpp>
+
+#include "flecs.h"
+
+namespace stagehand {
+    /// Each Flecs stage (one per worker thread, plus the main stage) only ever pushes to its own lane, and a stage is used by one thread at a
+    /// time, so pushing needs no synchronisation. Lanes are cleared rather than freed when drained, so once they have grown to the peak
+    /// number of items per frame, pushing doesn't allocate.
+    template <typename T> class PerStageQueue {
+      public:
+        /// Makes sure there is a lane for every stage of `world`. Call from the main thread while no system is running (e.g. in PreFrame),
+        /// since adding lanes may move the existing ones.
+        void prepare(const flecs::world &world) {
+            const size_t stage_count = static_cast<size_t>(world.get_stage_count());
+            if (lanes.size() < stage_count) {
+                lanes.resize(stage_count);
+            }
+        }
+
+        /// Returns the lane of the stage `world` refers to, or nullptr if prepare() hasn't run since that stage was created.
+        /// Inside a system, pass it.world() (the stage the system runs on), not the real world.
+        [[nodiscard]] std::vector<T> *lane(const flecs::world &world) {
+            const int32_t stage_id = world.get_stage_id();
+            if (unlikely(stage_id < 0 || static_cast<size_t>(stage_id) >= lanes.size())) {
+                return nullptr;
+            }
+            return &lanes[static_cast<size_t>(stage_id)];
+        }
+
+        /// Calls callback(const T &) for every queued item, lane by lane.
+        template <typename Callback> void for_each(Callback &&callback) const {
+            for (const std::vector<T> &lane : lanes) {
+                for (const T &item : lane) {
+                    callback(item);
+                }
+            }
+        }
+
+        /// Calls callback(T &) for every queued item, lane by lane, and clears the lanes. Call from the main thread only.
+        /// Each lane is swapped into `scratch` before its items are visited, so the callback may push new items; those stay queued for the
+        /// next drain.
+        template <typename Callback> void drain(std::vector<T> &scratch, Callback &&callback) {
+            for (std::vector<T> &lane : lanes) {
+                if (lane.empty()) {
+                    continue;
+                }
+                std::swap(lane, scratch);
+                for (T &item : scratch) {
+                    callback(item);
+                }
+                scratch.clear();
+            }
+        }
+
+        [[nodiscard]] bool empty() const {
+            for (const std::vector<T> &lane : lanes) {
+                if (!lane.empty()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+      private:
+        std::vector<std::vector<T>> lanes;
+    };
+} // namespace stagehand
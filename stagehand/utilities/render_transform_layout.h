@@ -0,0 +1,68 @@
+/// Conversion of Godot transforms to the float layout of MultiMesh instances (see multimesh_packing.h), shared by the MultiMesh renderer and
+/// the transform compose system, which keeps RenderTransform2D/3D up to date.
+#pragma once
+
+#include <godot_cpp/variant/transform2d.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+
+// The transform kernels below use SSE shuffles on x86-64, where SSE2 is always available. Builds targeting x86-64-v3 (see SConstruct) get
+// them VEX-encoded. Other architectures, and double precision builds of Godot, whose transforms don't hold floats, use the scalar kernels.
+#if (defined(__SSE2__) || defined(_M_X64)) && !defined(REAL_T_IS_DOUBLE)
+#define STAGEHAND_MULTIMESH_SIMD 1
+#include <immintrin.h>
+#else
+#define STAGEHAND_MULTIMESH_SIMD 0
+#endif
+
+namespace stagehand::rendering {
+#if STAGEHAND_MULTIMESH_SIMD
+    static_assert(sizeof(godot::Transform2D) == 6 * sizeof(float), "Transform2D is expected to be its three columns, back to back");
+    static_assert(sizeof(godot::Transform3D) == 12 * sizeof(float), "Transform3D is expected to be its three basis rows, then the origin");
+
+    /// (x.x, x.y, y.x, y.y | o.x, o.y) -> (x.x, y.x, 0, o.x, x.y, y.y, 0, o.y)
+    inline void pack_render_transform(const godot::Transform2D &transform, float *output) {
+        const float *source = &transform.columns[0].x;
+        const __m128 axes = _mm_loadu_ps(source);
+        // Loads the origin into the low half and clears the high half, which provides the padding zeros.
+        const __m128 origin = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(source + 4)));
+        _mm_storeu_ps(output, _mm_shuffle_ps(axes, origin, _MM_SHUFFLE(0, 2, 2, 0)));
+        _mm_storeu_ps(output + 4, _mm_shuffle_ps(axes, origin, _MM_SHUFFLE(1, 2, 3, 1)));
+    }
+
+    /// (r0.x, r0.y, r0.z, r1.x | r1.y, r1.z, r2.x, r2.y | r2.z, o.x, o.y, o.z) -> (r0.x, r0.y, r0.z, o.x, r1.x, r1.y, r1.z, o.y, r2.x, r2.y, r2.z, o.z)
+    inline void pack_render_transform(const godot::Transform3D &transform, float *output) {
+        const float *source = &transform.basis.rows[0].x;
+        const __m128 a = _mm_loadu_ps(source);
+        const __m128 b = _mm_loadu_ps(source + 4);
+        const __m128 c = _mm_loadu_ps(source + 8);
+        // (r0.z, r0.z, o.x, o.x)
+        const __m128 row0_tail = _mm_shuffle_ps(a, c, _MM_SHUFFLE(1, 1, 2, 2));
+        // (r1.x, r1.x, r1.y, r1.y) and (r1.z, r1.z, o.y, o.y)
+        const __m128 row1_head = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 3, 3));
+        const __m128 row1_tail = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 1, 1));
+        _mm_storeu_ps(output, _mm_shuffle_ps(a, row0_tail, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(output + 4, _mm_shuffle_ps(row1_head, row1_tail, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(output + 8, _mm_shuffle_ps(b, c, _MM_SHUFFLE(3, 0, 3, 2)));
+    }
+#else
+    inline void pack_render_transform(const godot::Transform2D &transform, float *output) {
+        output[0] = transform.columns[0].x;
+        output[1] = transform.columns[1].x;
+        output[2] = 0.0f;
+        output[3] = transform.columns[2].x;
+        output[4] = transform.columns[0].y;
+        output[5] = transform.columns[1].y;
+        output[6] = 0.0f;
+        output[7] = transform.columns[2].y;
+    }
+
+    inline void pack_render_transform(const godot::Transform3D &transform, float *output) {
+        for (int row = 0; row < 3; ++row) {
+            output[row * 4 + 0] = transform.basis.rows[row].x;
+            output[row * 4 + 1] = transform.basis.rows[row].y;
+            output[row * 4 + 2] = transform.basis.rows[row].z;
+            output[row * 4 + 3] = static_cast<float>(transform.origin[row]);
+        }
+    }
+#endif
+} // namespace stagehand::rendering
@@ -0,0 +1,99 @@
+/// Dedicated thread that runs one job at a time, used to progress the simulation while the main thread does the rest of Godot's frame.
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace stagehand {
+    /// start() hands the thread a job and returns right away; wait() blocks until that job has finished. The thread is created on the first
+    /// start() and sleeps between jobs, so a world that never progresses asynchronously never creates it.
+    /// Only one thread (the main thread) may call start() and wait().
+    class SimulationThread {
+      public:
+        SimulationThread() = default;
+        SimulationThread(const SimulationThread &) = delete;
+        SimulationThread &operator=(const SimulationThread &) = delete;
+        ~SimulationThread() { stop(); }
+
+        /// Runs `job` on the simulation thread. Waits for the previous job first, so at most one job is ever in flight.
+        void start(std::function<void()> job) {
+            wait();
+            if (!thread.joinable()) {
+                quitting = false;
+                thread = std::thread([this]() { run(); });
+                std::lock_guard<std::mutex> lock(mutex);
+                job_thread_id = thread.get_id();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending_job = std::move(job);
+                busy = true;
+            }
+            job_ready.notify_one();
+        }
+
+        /// Blocks until the job passed to the last start() has finished. Returns immediately if no job is in flight, or when called by the job
+        /// itself, which would otherwise wait for its own end.
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (std::this_thread::get_id() == job_thread_id) {
+                return;
+            }
+            job_done.wait(lock, [this]() { return !busy; });
+        }
+
+        /// Returns true while a job is in flight.
+        [[nodiscard]] bool is_busy() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return busy;
+        }
+
+        /// Waits for the job in flight, then ends the thread. start() creates a new one.
+        void stop() {
+            if (!thread.joinable()) {
+                return;
+            }
+            wait();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                quitting = true;
+            }
+            job_ready.notify_one();
+            thread.join();
+            std::lock_guard<std::mutex> lock(mutex);
+            job_thread_id = std::thread::id();
+        }
+
+      private:
+        void run() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                job_ready.wait(lock, [this]() { return busy || quitting; });
+                if (!busy) {
+                    return;
+                }
+
+                std::function<void()> job = std::move(pending_job);
+                lock.unlock();
+                job();
+                lock.lock();
+
+                busy = false;
+                job_done.notify_all();
+            }
+        }
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable job_ready;
+        std::condition_variable job_done;
+        std::function<void()> pending_job;
+        /// Written under `mutex`, so the job thread never sees it before it is set.
+        std::thread::id job_thread_id;
+        bool busy = false;
+        bool quitting = false;
+    };
+} // namespace stagehand
@@ -0,0 +1,123 @@
+#include "stagehand/utilities/worker_thread_pool_tasks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include "flecs.h"
+
+namespace {
+    /// Pool threads claimed by the Flecs workers of all worlds, and by the jobs in flight.
+    std::atomic<int> claimed_threads = 0;
+    std::atomic<bool> installed = false;
+
+    /// Adds up to `count` threads to claimed_threads without going over `limit`, and returns how many it added.
+    int claim_threads(int count, int limit) {
+        int claimed = claimed_threads.load();
+        int granted = 0;
+        do {
+            granted = std::clamp(limit - claimed, 0, std::max(count, 0));
+        } while (!claimed_threads.compare_exchange_weak(claimed, claimed + granted));
+        return granted;
+    }
+
+    /// One Flecs worker task in flight on the WorkerThreadPool.
+    struct FlecsTask {
+        ecs_os_thread_callback_t callback = nullptr;
+        void *param = nullptr;
+        void *result = nullptr;
+        int64_t task_id = -1;
+    };
+
+    void run_flecs_task(int64_t task_address) {
+        FlecsTask *task = reinterpret_cast<FlecsTask *>(static_cast<uintptr_t>(task_address));
+        task->result = task->callback(task->param);
+    }
+
+    void run_low_priority_task(int64_t callback_address, int64_t param_address) {
+        auto callback = reinterpret_cast<void *(*)(void *)>(static_cast<uintptr_t>(callback_address));
+        callback(reinterpret_cast<void *>(static_cast<uintptr_t>(param_address)));
+    }
+
+    ecs_os_thread_t worker_thread_pool_task_new(ecs_os_thread_callback_t callback, void *param) {
+        FlecsTask *task = new FlecsTask{callback, param};
+        const godot::Callable action = callable_mp_static(&run_flecs_task).bind(static_cast<int64_t>(reinterpret_cast<uintptr_t>(task)));
+        // Flecs workers wait for each other at every merge point, so they have to run at the same time. Low priority tasks only get a
+        // fraction of the pool's threads, which could leave some workers queued behind the ones waiting for them.
+        task->task_id = godot::WorkerThreadPool::get_singleton()->add_task(action, true, "Flecs worker");
+        return static_cast<ecs_os_thread_t>(reinterpret_cast<uintptr_t>(task));
+    }
+
+    void *worker_thread_pool_task_join(ecs_os_thread_t thread) {
+        FlecsTask *task = reinterpret_cast<FlecsTask *>(static_cast<uintptr_t>(thread));
+        godot::WorkerThreadPool::get_singleton()->wait_for_task_completion(task->task_id);
+        void *result = task->result;
+        delete task;
+        return result;
+    }
+} // namespace
+
+bool utilities::WorkerThreadPoolTasks::install() {
+    if (godot::WorkerThreadPool::get_singleton() == nullptr) {
+        return false;
+    }
+
+    // Worlds created with set_task_threads() create their workers with task_new_ at the start of every pipeline run and join them with
+    // task_join_ at the end, so each frame hands the pool one task per worker.
+    ecs_os_api.task_new_ = worker_thread_pool_task_new;
+    ecs_os_api.task_join_ = worker_thread_pool_task_join;
+    installed = true;
+    return true;
+}
+
+bool utilities::WorkerThreadPoolTasks::is_installed() { return installed; }
+
+int utilities::WorkerThreadPoolTasks::get_capacity() {
+    // Same rule as the WorkerThreadPool uses to size itself.
+    godot::ProjectSettings *project_settings = godot::ProjectSettings::get_singleton();
+    const int max_threads = project_settings != nullptr ? static_cast<int>(project_settings->get_setting("threading/worker_pool/max_threads", -1)) : -1;
+    if (max_threads > 0) {
+        return max_threads;
+    }
+    godot::OS *os = godot::OS::get_singleton();
+    return os != nullptr ? os->get_processor_count() : 1;
+}
+
+int utilities::WorkerThreadPoolTasks::get_high_priority_capacity() {
+    // Same rule as the WorkerThreadPool uses to cap the threads low priority tasks run on.
+    const int capacity = get_capacity();
+    godot::ProjectSettings *project_settings = godot::ProjectSettings::get_singleton();
+    const double low_priority_ratio =
+        project_settings != nullptr ? static_cast<double>(project_settings->get_setting("threading/worker_pool/low_priority_thread_ratio", 0.3)) : 0.3;
+    const int low_priority_threads = std::clamp(static_cast<int>(capacity * low_priority_ratio), 1, std::max(capacity - 1, 1));
+    return std::max(capacity - low_priority_threads, 0);
+}
+
+int utilities::WorkerThreadPoolTasks::claim(int workers) {
+    const int high_priority_capacity = get_high_priority_capacity();
+    return claim_threads(workers, high_priority_capacity - high_priority_capacity / 2);
+}
+
+void utilities::WorkerThreadPoolTasks::release(int workers) { claimed_threads.fetch_sub(workers); }
+
+int utilities::WorkerThreadPoolTasks::claim_jobs(int jobs) { return claim_threads(jobs, get_high_priority_capacity()); }
+
+void utilities::WorkerThreadPoolTasks::release_jobs(int jobs) { claimed_threads.fetch_sub(jobs); }
+
+int64_t utilities::WorkerThreadPoolTasks::add_low_priority_task(void *(*callback)(void *), void *param) {
+    if (!installed) {
+        return -1;
+    }
+    const godot::Callable action = callable_mp_static(&run_low_priority_task)
+                                       .bind(static_cast<int64_t>(reinterpret_cast<uintptr_t>(callback)),
+                                             static_cast<int64_t>(reinterpret_cast<uintptr_t>(param)));
+    return godot::WorkerThreadPool::get_singleton()->add_task(action, false, "Stagehand parallel_for");
+}
+
+void utilities::WorkerThreadPoolTasks::wait_for_task(int64_t task_id) { godot::WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id); }
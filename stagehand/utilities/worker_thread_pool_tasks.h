@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+namespace utilities {
+    /// Runs Flecs worker tasks on Godot's WorkerThreadPool, so every FlecsWorld shares Godot's threads instead of creating its own.
+    class WorkerThreadPoolTasks {
+      public:
+        /// Points the Flecs OS API task functions (used by worlds configured with set_task_threads()) at the WorkerThreadPool.
+        /// Safe to call more than once. Returns false if the WorkerThreadPool isn't available, in which case Flecs keeps its own threads.
+        static bool install();
+        /// Whether install() has pointed the Flecs task functions at the WorkerThreadPool.
+        static bool is_installed();
+
+        /// The number of threads in the WorkerThreadPool: the threading/worker_pool/max_threads project setting, or the processor count
+        /// when it isn't set.
+        static int get_capacity();
+        /// The pool threads that high priority tasks can always get. Low priority tasks only ever take the others (see the
+        /// threading/worker_pool/low_priority_thread_ratio project setting), however long they run.
+        static int get_high_priority_capacity();
+        /// Claims up to `workers` pool threads for the Flecs workers of one world and returns how many it got.
+        /// Flecs workers wait for each other at every merge point, so the workers of all worlds together must never outnumber the pool's
+        /// threads: a worker left queued would keep the running ones waiting for it forever. Half of the high priority threads are never
+        /// handed out here, so the jobs systems start while the workers wait at a merge point have threads to run on.
+        static int claim(int workers);
+        /// Gives back threads claimed with claim().
+        static void release(int workers);
+        /// Claims up to `jobs` pool threads for jobs that a system starts with ecs_os_task_new() and then waits for, and returns how many it
+        /// got. Unlike claim(), every high priority thread nobody has claimed can be handed out, including the ones claim() keeps free.
+        static int claim_jobs(int jobs);
+        /// Gives back threads claimed with claim_jobs().
+        static void release_jobs(int jobs);
+
+        /// Runs callback(param) as a low priority WorkerThreadPool task and returns its id, or -1 if install() hasn't succeeded. For jobs that
+        /// may run across frames: low priority tasks never take the threads claim() hands out, so they can't hold up the Flecs workers.
+        static int64_t add_low_priority_task(void *(*callback)(void *), void *param);
+        /// Blocks until a task started with add_low_priority_task() has finished.
+        static void wait_for_task(int64_t task_id);
+    };
+} // namespace utilities
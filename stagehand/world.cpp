@@ -1,28 +1,79 @@
 #include "stagehand/world.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
+#include <vector>
 
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/multi_mesh.hpp>
 #include <godot_cpp/classes/multi_mesh_instance2d.hpp>
 #include <godot_cpp/classes/multi_mesh_instance3d.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 #include "stagehand/ecs/components/event_payload.h"
+#include "stagehand/ecs/components/interpolation.h"
+#include "stagehand/ecs/components/parallelism.h"
+#include "stagehand/ecs/components/simulation_lod.h"
+#include "stagehand/ecs/components/task.h"
+#include "stagehand/ecs/components/tick_rate.h"
+#include "stagehand/ecs/components/time_budget.h"
 #include "stagehand/ecs/components/rendering.h"
 #include "stagehand/ecs/components/scene_children.h"
 #include "stagehand/ecs/components/world_configuration.h"
+#include "stagehand/ecs/pipeline_phases.h"
+#include "stagehand/ecs/systems/event_queues.h"
+#include "stagehand/ecs/systems/interpolation.h"
 #include "stagehand/ecs/systems/rendering_instanced.h"
 #include "stagehand/ecs/systems/rendering_multimesh.h"
 #include "stagehand/nodes/instanced_renderer_3d.h"
 #include "stagehand/nodes/multi_mesh_renderer.h"
 #include "stagehand/registry.h"
 #include "stagehand/utilities/platform.h"
+#include "stagehand/utilities/worker_thread_pool_tasks.h"
 
 namespace stagehand {
+    namespace {
+        /// Converts a column of event values into the matching packed array when every value has the same packable type.
+        godot::Variant pack_signal_column(const godot::Array &values) {
+            if (values.is_empty()) {
+                return values;
+            }
+
+            const godot::Variant::Type type = values[0].get_type();
+            for (int64_t i = 1; i < values.size(); ++i) {
+                if (values[i].get_type() != type) {
+                    return values;
+                }
+            }
+
+            switch (type) {
+            case godot::Variant::INT:
+                return godot::PackedInt64Array(values);
+            case godot::Variant::FLOAT:
+                return godot::PackedFloat64Array(values);
+            case godot::Variant::STRING:
+            case godot::Variant::STRING_NAME:
+                return godot::PackedStringArray(values);
+            case godot::Variant::VECTOR2:
+                return godot::PackedVector2Array(values);
+            case godot::Variant::VECTOR3:
+                return godot::PackedVector3Array(values);
+            case godot::Variant::VECTOR4:
+                return godot::PackedVector4Array(values);
+            case godot::Variant::COLOR:
+                return godot::PackedColorArray(values);
+            default:
+                return values;
+            }
+        }
+    } // namespace
+
     FlecsWorld::FlecsWorld() {
         if (unlikely(is_initialised)) {
             godot::UtilityFunctions::push_warning(godot::String("FlecsWorld's constructor was called when it was already initialised"));
@@ -37,16 +88,18 @@ namespace stagehand {
         // flecs::log::set_level(1);
 #endif
 
-        // Set the number of threads Flecs should use based on CPU thread count
-        unsigned int num_threads = ::utilities::Platform::get_thread_count();
-        world.set_threads(static_cast<int>(num_threads));
+        // Run the Flecs workers on Godot's WorkerThreadPool when it is available, so several worlds don't each start a thread per core.
+        use_worker_thread_pool = ::utilities::WorkerThreadPoolTasks::install();
+        apply_max_parallelism();
 
-        // Register the components and systems, then populate the getter/setter maps.
+        // Register the components and systems, then build the dense component binding table.
+        // The qualified and the fallback name of a component share one binding (and therefore one handle).
         register_components_and_systems_with_world(world);
+        default_pipeline = world.get_pipeline();
+        std::unordered_map<flecs::entity_t, int64_t> handles_by_component_id;
         for (const auto &[component_name, funcs] : get_component_registry()) {
             godot::StringName name(component_name.c_str());
 
-            // Cache the component entity ID for fast lookups in has/add/remove.
             // Prefer the entity_id stored during registration (always correct),
             // falling back to world.lookup() for components registered without
             // register_component_with_world_name.
@@ -54,16 +107,25 @@ namespace stagehand {
             if (comp_id == 0) {
                 comp_id = world.lookup(component_name.c_str()).id();
             }
-            component_ids[name] = comp_id;
 
-            if (funcs.setter) {
-                component_setters[name] = [this, global_setter = funcs.setter](flecs::entity_t entity_id, const godot::Variant &data) {
-                    global_setter(this->world, entity_id, data);
-                };
-            }
-            if (funcs.getter) {
-                component_getters[name] = [this, global_getter = funcs.getter](flecs::entity_t entity_id) { return global_getter(this->world, entity_id); };
+            int64_t handle = static_cast<int64_t>(component_bindings.size());
+            const auto existing_handle = comp_id != 0 ? handles_by_component_id.find(comp_id) : handles_by_component_id.end();
+            if (existing_handle != handles_by_component_id.end()) {
+                handle = existing_handle->second;
+            } else {
+                component_bindings.push_back(ComponentBinding{name, comp_id, funcs.getter, funcs.setter, funcs.bulk_setter, funcs.column_getter,
+                                                              funcs.bulk_values_check});
+                if (comp_id != 0) {
+                    handles_by_component_id[comp_id] = handle;
+                }
             }
+            component_handles[name] = handle;
+        }
+
+        const std::vector<TypedEventType> &typed_event_types = internal::get_typed_event_types();
+        typed_event_names.reserve(typed_event_types.size());
+        for (const TypedEventType &event_type : typed_event_types) {
+            typed_event_names.emplace_back(event_type.name);
         }
 
         connect("tree_entered", callable_mp(this, &FlecsWorld::_enter_tree));
@@ -73,17 +135,59 @@ namespace stagehand {
         is_initialised = true;
     }
 
+    const FlecsWorld::ComponentBinding *FlecsWorld::find_component_binding(const godot::StringName &component_name) const {
+        const auto handle = component_handles.find(component_name);
+        return handle != component_handles.end() ? &component_bindings[handle->second] : nullptr;
+    }
+
+    const FlecsWorld::ComponentBinding *FlecsWorld::get_component_binding(int64_t component_handle) const {
+        if (unlikely(component_handle < 0 || component_handle >= static_cast<int64_t>(component_bindings.size()))) {
+            godot::UtilityFunctions::push_warning(godot::String("Invalid component handle: ") + godot::String::num_int64(component_handle));
+            return nullptr;
+        }
+        return &component_bindings[component_handle];
+    }
+
+    int64_t FlecsWorld::get_component_handle(const godot::StringName &component_name) const {
+        const auto handle = component_handles.find(component_name);
+        if (unlikely(handle == component_handles.end())) {
+            godot::UtilityFunctions::push_warning("Component not found: " + component_name);
+            return -1;
+        }
+        return handle->second;
+    }
+
     void FlecsWorld::set_component(const godot::StringName &component_name, const godot::Variant &data, uint64_t entity_id) {
         if (unlikely(!is_initialised)) {
             godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_component was called before world was initialised"));
             return;
         }
 
-        if (likely(component_setters.contains(component_name))) {
-            component_setters[component_name](static_cast<ecs_entity_t>(entity_id), data);
-        } else {
+        const ComponentBinding *binding = find_component_binding(component_name);
+        if (unlikely(binding == nullptr || binding->setter == nullptr)) {
             godot::UtilityFunctions::push_warning(godot::String("No setter for component '") + component_name + "' found.");
+            return;
+        }
+        set_component_with(binding, data, entity_id);
+    }
+
+    void FlecsWorld::set_component_by_handle(int64_t component_handle, const godot::Variant &data, uint64_t entity_id) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_component_by_handle was called before world was initialised"));
+            return;
         }
+
+        const ComponentBinding *binding = get_component_binding(component_handle);
+        if (unlikely(binding == nullptr || binding->setter == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("No setter for component handle ") + godot::String::num_int64(component_handle) + " found.");
+            return;
+        }
+        set_component_with(binding, data, entity_id);
+    }
+
+    void FlecsWorld::set_component_with(const ComponentBinding *binding, const godot::Variant &data, uint64_t entity_id) {
+        wait_for_simulation();
+        binding->setter(world, static_cast<ecs_entity_t>(entity_id), data, binding->name);
     }
 
     godot::Variant FlecsWorld::get_component(const godot::StringName &component_name, uint64_t entity_id) {
@@ -92,12 +196,31 @@ namespace stagehand {
             return godot::Variant();
         }
 
-        if (unlikely(!component_getters.contains(component_name))) {
+        const ComponentBinding *binding = find_component_binding(component_name);
+        if (unlikely(binding == nullptr || binding->getter == nullptr)) {
             godot::UtilityFunctions::push_warning(godot::String("No getter for component '") + component_name + "' found.");
             return godot::Variant();
         }
+        return get_component_with(binding, entity_id);
+    }
+
+    godot::Variant FlecsWorld::get_component_by_handle(int64_t component_handle, uint64_t entity_id) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::get_component_by_handle was called before world was initialised"));
+            return godot::Variant();
+        }
+
+        const ComponentBinding *binding = get_component_binding(component_handle);
+        if (unlikely(binding == nullptr || binding->getter == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("No getter for component handle ") + godot::String::num_int64(component_handle) + " found.");
+            return godot::Variant();
+        }
+        return get_component_with(binding, entity_id);
+    }
 
-        return component_getters[component_name](static_cast<ecs_entity_t>(entity_id));
+    godot::Variant FlecsWorld::get_component_with(const ComponentBinding *binding, uint64_t entity_id) {
+        wait_for_simulation();
+        return binding->getter(world, static_cast<ecs_entity_t>(entity_id), binding->name);
     }
 
     bool FlecsWorld::has_component(const godot::StringName &component_name, uint64_t entity_id) {
@@ -105,12 +228,28 @@ namespace stagehand {
             godot::UtilityFunctions::push_warning("FlecsWorld::has_component called before world initialised");
             return false;
         }
-        if (unlikely(!component_ids.contains(component_name))) {
+
+        const ComponentBinding *binding = find_component_binding(component_name);
+        if (unlikely(binding == nullptr)) {
             godot::UtilityFunctions::push_warning("Component not found: " + component_name);
             return false;
         }
+        return has_component_with(binding, entity_id);
+    }
+
+    bool FlecsWorld::has_component_by_handle(int64_t component_handle, uint64_t entity_id) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::has_component_by_handle called before world initialised");
+            return false;
+        }
+
+        const ComponentBinding *binding = get_component_binding(component_handle);
+        return likely(binding != nullptr) && has_component_with(binding, entity_id);
+    }
 
-        const ecs_entity_t component_id = component_ids[component_name];
+    bool FlecsWorld::has_component_with(const ComponentBinding *binding, uint64_t entity_id) {
+        wait_for_simulation();
+        const ecs_entity_t component_id = binding->id;
         if (entity_id == 0) {
             return world.entity(component_id).has(component_id);
         }
@@ -125,12 +264,30 @@ namespace stagehand {
             godot::UtilityFunctions::push_warning("FlecsWorld::add_component called before world initialised");
             return;
         }
-        if (unlikely(!component_ids.contains(component_name))) {
+
+        const ComponentBinding *binding = find_component_binding(component_name);
+        if (unlikely(binding == nullptr)) {
             godot::UtilityFunctions::push_warning("Component not found: " + component_name);
             return;
         }
+        add_component_with(binding, entity_id);
+    }
+
+    void FlecsWorld::add_component_by_handle(int64_t component_handle, uint64_t entity_id) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::add_component_by_handle called before world initialised");
+            return;
+        }
 
-        const ecs_entity_t component_id = component_ids[component_name];
+        const ComponentBinding *binding = get_component_binding(component_handle);
+        if (likely(binding != nullptr)) {
+            add_component_with(binding, entity_id);
+        }
+    }
+
+    void FlecsWorld::add_component_with(const ComponentBinding *binding, uint64_t entity_id) {
+        wait_for_simulation();
+        const ecs_entity_t component_id = binding->id;
         if (entity_id == 0) {
             world.entity(component_id).add(component_id);
             return;
@@ -146,12 +303,30 @@ namespace stagehand {
             godot::UtilityFunctions::push_warning("FlecsWorld::remove_component called before world initialised");
             return;
         }
-        if (unlikely(!component_ids.contains(component_name))) {
+
+        const ComponentBinding *binding = find_component_binding(component_name);
+        if (unlikely(binding == nullptr)) {
             godot::UtilityFunctions::push_warning("Component not found: " + component_name);
             return;
         }
+        remove_component_with(binding, entity_id);
+    }
+
+    void FlecsWorld::remove_component_by_handle(int64_t component_handle, uint64_t entity_id) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::remove_component_by_handle called before world initialised");
+            return;
+        }
 
-        const ecs_entity_t component_id = component_ids[component_name];
+        const ComponentBinding *binding = get_component_binding(component_handle);
+        if (likely(binding != nullptr)) {
+            remove_component_with(binding, entity_id);
+        }
+    }
+
+    void FlecsWorld::remove_component_with(const ComponentBinding *binding, uint64_t entity_id) {
+        wait_for_simulation();
+        const ecs_entity_t component_id = binding->id;
         if (entity_id == 0) {
             world.entity(component_id).remove(component_id);
             return;
@@ -162,11 +337,185 @@ namespace stagehand {
         world.entity(flecs_entity_id).remove(component_id);
     }
 
+    int64_t FlecsWorld::set_components_bulk(const godot::StringName &component_name, const godot::PackedInt64Array &entity_ids, const godot::Variant &values) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::set_components_bulk called before world initialised");
+            return 0;
+        }
+
+        const ComponentBinding *binding = find_component_binding(component_name);
+        if (unlikely(binding == nullptr || binding->bulk_setter == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("No bulk setter for component '") + component_name + "' found.");
+            return 0;
+        }
+        return set_components_bulk_with(binding, entity_ids, values);
+    }
+
+    int64_t FlecsWorld::set_components_bulk_by_handle(int64_t component_handle, const godot::PackedInt64Array &entity_ids, const godot::Variant &values) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::set_components_bulk_by_handle called before world initialised");
+            return 0;
+        }
+
+        const ComponentBinding *binding = get_component_binding(component_handle);
+        if (unlikely(binding == nullptr || binding->bulk_setter == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("No bulk setter for component handle ") + godot::String::num_int64(component_handle) +
+                                                  " found.");
+            return 0;
+        }
+        return set_components_bulk_with(binding, entity_ids, values);
+    }
+
+    int64_t FlecsWorld::set_components_bulk_with(const ComponentBinding *binding, const godot::PackedInt64Array &entity_ids, const godot::Variant &values) {
+        wait_for_simulation();
+        return binding->bulk_setter(world, entity_ids, values, binding->name);
+    }
+
+    godot::Dictionary FlecsWorld::get_component_column(const godot::StringName &component_name, const godot::Variant &query_or_prefab) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::get_component_column called before world initialised");
+            return godot::Dictionary();
+        }
+
+        const ComponentBinding *binding = find_component_binding(component_name);
+        if (unlikely(binding == nullptr || binding->column_getter == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("No column getter for component '") + component_name + "' found.");
+            return godot::Dictionary();
+        }
+        return get_component_column_with(binding, query_or_prefab);
+    }
+
+    godot::Dictionary FlecsWorld::get_component_column_by_handle(int64_t component_handle, const godot::Variant &query_or_prefab) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::get_component_column_by_handle called before world initialised");
+            return godot::Dictionary();
+        }
+
+        const ComponentBinding *binding = get_component_binding(component_handle);
+        if (unlikely(binding == nullptr || binding->column_getter == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("No column getter for component handle ") + godot::String::num_int64(component_handle) +
+                                                  " found.");
+            return godot::Dictionary();
+        }
+        return get_component_column_with(binding, query_or_prefab);
+    }
+
+    godot::Dictionary FlecsWorld::get_component_column_with(const ComponentBinding *binding, const godot::Variant &query_or_prefab) {
+        wait_for_simulation();
+        godot::Dictionary result;
+        godot::PackedInt64Array entity_ids;
+
+        const godot::Variant::Type filter_type = query_or_prefab.get_type();
+        if (filter_type == godot::Variant::OBJECT) {
+            const FlecsQuery *flecs_query = godot::Object::cast_to<FlecsQuery>(static_cast<godot::Object *>(query_or_prefab));
+            if (unlikely(flecs_query == nullptr || flecs_query->owner != this)) {
+                godot::UtilityFunctions::push_warning("FlecsWorld::get_component_column expects a valid FlecsQuery created by this world");
+                return result;
+            }
+            const int8_t field_index = flecs_query->find_field_index(binding->id);
+            if (unlikely(field_index < 0)) {
+                godot::UtilityFunctions::push_warning(godot::String("Component '") + binding->name + "' is not a required term of the query.");
+                return result;
+            }
+            const godot::Variant values = binding->column_getter(flecs_query->query, field_index, entity_ids);
+            result["entity_ids"] = entity_ids;
+            result["values"] = values;
+            return result;
+        }
+
+        flecs::entity_t prefab = 0;
+        if (filter_type == godot::Variant::STRING || filter_type == godot::Variant::STRING_NAME) {
+            const godot::StringName prefab_name = query_or_prefab;
+            if (!prefab_name.is_empty()) {
+                prefab = prefab_registry.resolve(world, prefab_name);
+                if (unlikely(prefab == 0)) {
+                    godot::UtilityFunctions::push_warning(godot::String("Prefab '") + prefab_name + "' not found");
+                    return result;
+                }
+            }
+        } else if (unlikely(filter_type != godot::Variant::NIL)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::get_component_column expects a FlecsQuery, a prefab name or null, got ") +
+                                                  godot::Variant::get_type_name(filter_type));
+            return result;
+        }
+
+        // Scripts tend to read the same columns every frame, so the query of each component and prefab is built once and kept.
+        const std::pair<flecs::entity_t, flecs::entity_t> key(binding->id, prefab);
+        auto column_query = column_queries.find(key);
+        if (column_query == column_queries.end()) {
+            flecs::query_builder<> builder = world.query_builder();
+            builder.with(binding->id).in();
+            if (prefab != 0) {
+                builder.with(flecs::IsA, prefab);
+            }
+            column_query = column_queries.emplace(key, builder.cached().build()).first;
+        }
+        const godot::Variant values = binding->column_getter(column_query->second, 0, entity_ids);
+        result["entity_ids"] = entity_ids;
+        result["values"] = values;
+        return result;
+    }
+
+    void FlecsWorld::release_column_queries() {
+        for (auto &[key, query] : column_queries) {
+            query.destruct();
+        }
+        column_queries.clear();
+    }
+
+    godot::Ref<FlecsQuery> FlecsWorld::create_query(const godot::Variant &terms) {
+        godot::Ref<FlecsQuery> result;
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::create_query called before world initialised");
+            return result;
+        }
+        wait_for_simulation();
+
+        flecs::query_builder<> builder = world.query_builder();
+        godot::CharString expression; // Must outlive build(), as the builder only keeps a pointer to it.
+
+        const godot::Variant::Type terms_type = terms.get_type();
+        if (terms_type == godot::Variant::STRING || terms_type == godot::Variant::STRING_NAME) {
+            expression = godot::String(terms).utf8();
+            builder.expr(expression.get_data());
+        } else if (terms_type == godot::Variant::PACKED_STRING_ARRAY || terms_type == godot::Variant::ARRAY) {
+            const godot::Array component_names = terms;
+            if (unlikely(component_names.is_empty())) {
+                godot::UtilityFunctions::push_warning("FlecsWorld::create_query needs at least one component");
+                return result;
+            }
+            for (int64_t i = 0; i < component_names.size(); ++i) {
+                const godot::StringName component_name = component_names[i];
+                const ComponentBinding *binding = find_component_binding(component_name);
+                if (unlikely(binding == nullptr)) {
+                    godot::UtilityFunctions::push_warning(godot::String("Component not found: ") + component_name);
+                    return result;
+                }
+                builder.with(binding->id).in();
+            }
+        } else {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::create_query expects a list of component names or a query string, got ") +
+                                                  godot::Variant::get_type_name(terms_type));
+            return result;
+        }
+
+        flecs::query<> query = builder.cached().detect_changes().build();
+        if (unlikely(query.c_ptr() == nullptr)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::create_query failed to build the query: ") + godot::String(terms));
+            return result;
+        }
+
+        result.instantiate();
+        result->setup(this, std::move(query));
+        return result;
+    }
+
     bool FlecsWorld::enable_entity(uint64_t entity_id, bool enabled) {
         if (unlikely(!is_initialised)) {
             godot::UtilityFunctions::push_warning("FlecsWorld::enable_entity called before world initialised");
             return false;
         }
+        wait_for_simulation();
 
         flecs::entity entity = world.entity(static_cast<ecs_entity_t>(entity_id));
         if (unlikely(!entity.is_valid())) {
@@ -178,11 +527,49 @@ namespace stagehand {
         return true;
     }
 
+    int64_t FlecsWorld::set_entities_enabled(const godot::PackedInt64Array &entity_ids, bool enabled) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::set_entities_enabled called before world initialised");
+            return 0;
+        }
+        wait_for_simulation();
+
+        const int64_t *ids = entity_ids.ptr();
+        const int64_t count = entity_ids.size();
+        int64_t updated_count = 0;
+
+        // One defer bracket lets Flecs batch the table moves and observer notifications of the whole set.
+        // A readonly world (e.g. when called from inside a system) already defers all operations.
+        const bool should_defer = !world.is_readonly();
+        if (should_defer) {
+            world.defer_begin();
+        }
+        for (int64_t i = 0; i < count; ++i) {
+            const ecs_entity_t entity_id = static_cast<ecs_entity_t>(ids[i]);
+            if (unlikely(entity_id == 0 || !world.is_alive(entity_id))) {
+                continue;
+            }
+            flecs::entity entity(world, entity_id);
+            enabled ? entity.enable() : entity.disable();
+            ++updated_count;
+        }
+        if (should_defer) {
+            world.defer_end();
+        }
+
+        if (unlikely(updated_count < count)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_entities_enabled skipped ") + godot::String::num_int64(count - updated_count) +
+                                                  " entities that are not alive.");
+        }
+        return updated_count;
+    }
+
     bool FlecsWorld::run_system(const godot::Variant &system, const Dictionary &parameters) {
         if (unlikely(!is_initialised)) {
             godot::UtilityFunctions::push_warning("FlecsWorld::run_system called before world initialised");
             return false;
         }
+        wait_for_simulation();
 
         uint64_t entity_id;
         if (system.get_type() == godot::Variant::INT) {
@@ -210,6 +597,7 @@ namespace stagehand {
             godot::UtilityFunctions::push_warning("FlecsWorld::create_entity called before world initialised");
             return 0;
         }
+        wait_for_simulation();
         if (name.is_empty()) {
             return static_cast<uint64_t>(world.entity().id());
         }
@@ -219,24 +607,64 @@ namespace stagehand {
     void FlecsWorld::destroy_entity(uint64_t entity_id) {
         if (unlikely(!is_initialised))
             return;
+        wait_for_simulation();
         world.entity(static_cast<ecs_entity_t>(entity_id)).destruct();
     }
 
+    int64_t FlecsWorld::destroy_entities(const godot::PackedInt64Array &entity_ids) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::destroy_entities called before world initialised");
+            return 0;
+        }
+        wait_for_simulation();
+
+        const int64_t *ids = entity_ids.ptr();
+        const int64_t count = entity_ids.size();
+        int64_t destroyed_count = 0;
+
+        // One defer bracket lets Flecs batch the table moves and observer notifications of the whole set.
+        // A readonly world (e.g. when called from inside a system) already defers all operations.
+        const bool should_defer = !world.is_readonly();
+        if (should_defer) {
+            world.defer_begin();
+        }
+        for (int64_t i = 0; i < count; ++i) {
+            const ecs_entity_t entity_id = static_cast<ecs_entity_t>(ids[i]);
+            if (unlikely(entity_id == 0 || !world.is_alive(entity_id))) {
+                continue;
+            }
+            flecs::entity(world, entity_id).destruct();
+            ++destroyed_count;
+        }
+        if (should_defer) {
+            world.defer_end();
+        }
+
+        if (unlikely(destroyed_count < count)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::destroy_entities skipped ") + godot::String::num_int64(count - destroyed_count) +
+                                                  " entities that are not alive.");
+        }
+        return destroyed_count;
+    }
+
     bool FlecsWorld::is_alive(uint64_t entity_id) {
         if (unlikely(!is_initialised))
             return false;
+        wait_for_simulation();
         return world.entity(static_cast<ecs_entity_t>(entity_id)).is_alive();
     }
 
     uint64_t FlecsWorld::lookup(const godot::String &name) {
         if (unlikely(!is_initialised))
             return 0;
+        wait_for_simulation();
         return world.lookup(name.utf8().get_data()).id();
     }
 
     godot::String FlecsWorld::get_entity_name(uint64_t entity_id) {
         if (unlikely(!is_initialised))
             return "";
+        wait_for_simulation();
         return godot::String(world.entity(static_cast<ecs_entity_t>(entity_id)).name().c_str());
     }
 
@@ -245,21 +673,52 @@ namespace stagehand {
             godot::UtilityFunctions::push_warning("FlecsWorld::instantiate_prefab called before world initialised");
             return 0;
         }
+        wait_for_simulation();
 
-        flecs::entity prefab = world.lookup(godot::String(prefab_name).utf8().get_data());
-        if (unlikely(!prefab.is_valid())) {
+        const flecs::entity_t prefab_id = prefab_registry.resolve(world, prefab_name);
+        if (unlikely(prefab_id == 0)) {
             godot::UtilityFunctions::push_warning(godot::String("Prefab '") + prefab_name + "' not found");
             return 0;
         }
 
-        flecs::entity instance = world.entity().is_a(prefab);
+        return instantiate_prefab_with(prefab_id, components);
+    }
+
+    int64_t FlecsWorld::get_prefab_handle(const godot::StringName &prefab_name) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::get_prefab_handle called before world initialised");
+            return -1;
+        }
+        wait_for_simulation();
+        return prefab_registry.get_handle(world, prefab_name);
+    }
+
+    uint64_t FlecsWorld::instantiate_prefab_by_handle(int64_t prefab_handle, const godot::Dictionary &components) {
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::instantiate_prefab_by_handle called before world initialised");
+            return 0;
+        }
+        wait_for_simulation();
+
+        const flecs::entity_t prefab_id = prefab_registry.resolve(world, prefab_handle);
+        if (unlikely(prefab_id == 0)) {
+            godot::UtilityFunctions::push_warning(godot::String("Invalid prefab handle: ") + godot::String::num_int64(prefab_handle));
+            return 0;
+        }
+
+        return instantiate_prefab_with(prefab_id, components);
+    }
+
+    uint64_t FlecsWorld::instantiate_prefab_with(flecs::entity_t prefab_id, const godot::Dictionary &components) {
+        flecs::entity instance = world.entity().is_a(prefab_id);
 
         if (!components.is_empty()) {
             godot::Array keys = components.keys();
             for (int i = 0; i < keys.size(); ++i) {
                 godot::StringName key = keys[i];
-                if (component_setters.count(key)) {
-                    component_setters[key](instance.id(), components[key]);
+                const ComponentBinding *binding = find_component_binding(key);
+                if (binding != nullptr && binding->setter != nullptr) {
+                    binding->setter(world, instance.id(), components[key], binding->name);
                 } else {
                     godot::UtilityFunctions::push_warning(godot::String("No setter found for component '") + key + "'");
                 }
@@ -269,11 +728,101 @@ namespace stagehand {
         return static_cast<uint64_t>(instance.id());
     }
 
+    godot::PackedInt64Array FlecsWorld::instantiate_prefab_batch(const godot::StringName &prefab_name, int64_t count, const godot::Dictionary &components) {
+        godot::PackedInt64Array entity_ids;
+        if (unlikely(!is_initialised)) {
+            godot::UtilityFunctions::push_warning("FlecsWorld::instantiate_prefab_batch called before world initialised");
+            return entity_ids;
+        }
+        wait_for_simulation();
+        // ecs_bulk_init() takes a 32-bit count.
+        if (unlikely(count <= 0 || count > std::numeric_limits<int32_t>::max())) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::instantiate_prefab_batch count must be between 1 and ") +
+                                                  godot::String::num_int64(std::numeric_limits<int32_t>::max()) + ", got " + godot::String::num_int64(count));
+            return entity_ids;
+        }
+
+        const flecs::entity_t prefab = prefab_registry.resolve(world, prefab_name);
+        if (unlikely(prefab == 0)) {
+            godot::UtilityFunctions::push_warning(godot::String("Prefab '") + prefab_name + "' not found");
+            return entity_ids;
+        }
+
+        // Adding the overridden components up front makes every instance land in its final table, so the values below are written in place.
+        ecs_bulk_desc_t desc = {};
+        desc.count = static_cast<int32_t>(count);
+        int32_t id_count = 0;
+        desc.ids[id_count++] = ecs_pair(flecs::IsA, prefab);
+
+        // Every value array is checked before any entity is created, so a mismatch can't leave half-initialised instances behind.
+        const godot::Array keys = components.keys();
+        std::vector<std::pair<const ComponentBinding *, godot::Variant>> component_values;
+        component_values.reserve(keys.size());
+        int64_t overflowing_id_count = 0;
+        for (int64_t i = 0; i < keys.size(); ++i) {
+            const godot::StringName key = keys[i];
+            const ComponentBinding *binding = find_component_binding(key);
+            if (unlikely(binding == nullptr || binding->bulk_setter == nullptr)) {
+                godot::UtilityFunctions::push_warning(godot::String("No bulk setter found for component '") + key + "'");
+                continue;
+            }
+            const godot::Variant values = components[key];
+            const int64_t value_count = packed_arrays::get_size(values);
+            if (unlikely(value_count != count || !binding->bulk_values_check(values))) {
+                godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::instantiate_prefab_batch: expected ") + godot::String::num_int64(count) +
+                                                      " values for component '" + binding->name + "', got " +
+                                                      (value_count < 0 ? godot::String() : godot::String::num_int64(value_count) + " in a ") +
+                                                      godot::Variant::get_type_name(values.get_type()) + "; no instances were created");
+                return entity_ids;
+            }
+            component_values.emplace_back(binding, values);
+
+            const ecs_id_t component_id = binding->id;
+            if (component_id == 0 || std::find(desc.ids, desc.ids + id_count, component_id) != desc.ids + id_count) {
+                continue;
+            }
+            if (id_count < FLECS_ID_DESC_MAX - 1) {
+                desc.ids[id_count++] = component_id;
+            } else {
+                ++overflowing_id_count;
+            }
+        }
+        if (unlikely(overflowing_id_count > 0)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::instantiate_prefab_batch: ") + godot::String::num_int64(overflowing_id_count) +
+                                                  " components didn't fit in the bulk creation and are added to each instance afterwards");
+        }
+
+        entity_ids.resize(count);
+        int64_t *ids = entity_ids.ptrw();
+        if (likely(!world.is_deferred())) {
+            const ecs_entity_t *new_entity_ids = ecs_bulk_init(world.c_ptr(), &desc);
+            for (int64_t i = 0; i < count; ++i) {
+                ids[i] = static_cast<int64_t>(new_entity_ids[i]);
+            }
+        } else {
+            // Bulk creation isn't available while the world is deferred (e.g. when called from a system callback).
+            for (int64_t i = 0; i < count; ++i) {
+                flecs::entity instance = world.entity().is_a(prefab);
+                for (int32_t id_index = 1; id_index < id_count; ++id_index) {
+                    instance.add(desc.ids[id_index]);
+                }
+                ids[i] = static_cast<int64_t>(instance.id());
+            }
+        }
+
+        for (const auto &[binding, values] : component_values) {
+            binding->bulk_setter(world, entity_ids, values, binding->name);
+        }
+
+        return entity_ids;
+    }
+
     void FlecsWorld::emit_event(const godot::StringName &event_name, const godot::Dictionary &data, uint64_t source_entity_id) {
         if (unlikely(!is_initialised)) {
             godot::UtilityFunctions::push_warning("FlecsWorld::emit_flecs_event called before world initialised");
             return;
         }
+        wait_for_simulation();
 
         stagehand::EventPayload payload;
         payload.name = event_name;
@@ -290,26 +839,431 @@ namespace stagehand {
             }
             emitter_entity_id = static_cast<ecs_entity_t>(source_entity_id);
         } else {
-            emitter_entity_id = world.entity("stagehand::internal::no_source_event_emitter").id();
+            emitter_entity_id = world.get<stagehand::SignalQueue>().no_source_emitter;
             payload.source_entity_id = 0;
         }
 
         // Flecs requires:
         // - desc.event to be a component type when using desc.param (payload)
         // - at least one id; use EcsAny as a generic id for Stagehand events.
+        refresh_signal_listeners();
         world.event<stagehand::EventPayload>().id(flecs::Any).entity(emitter_entity_id).ctx(std::move(payload)).emit();
     }
 
     void FlecsWorld::set_progress_tick(ProgressTick p_progress_tick) {
+        // Never switch pipelines under a running simulation step.
+        wait_for_simulation();
+        async_simulation_started = false;
         progress_tick = p_progress_tick;
 
         set_process(false);
         set_physics_process(false);
 
-        if (progress_tick == ProgressTick::PROGRESS_TICK_RENDERING) {
+        if (progress_tick == ProgressTick::PROGRESS_TICK_RENDERING || progress_tick == ProgressTick::PROGRESS_TICK_FIXED) {
             set_process(true);
         } else if (progress_tick == ProgressTick::PROGRESS_TICK_PHYSICS) {
             set_physics_process(true);
+        } else if (progress_tick == ProgressTick::PROGRESS_TICK_SPLIT) {
+            set_process(true);
+            set_physics_process(true);
+        } else if (progress_tick == ProgressTick::PROGRESS_TICK_ASYNC) {
+            set_process(true);
+        }
+
+        update_async_frame_connection();
+        apply_progress_tick_pipeline();
+    }
+
+    void FlecsWorld::update_async_frame_connection() {
+        if (!is_inside_tree()) {
+            return;
+        }
+
+        // SceneTree emits process_frame before any node's _process(), which is where the simulation step is started.
+        const godot::Callable start_callable = callable_mp(this, &FlecsWorld::start_async_simulation);
+        godot::SceneTree *tree = get_tree();
+        const bool connected = tree->is_connected("process_frame", start_callable);
+        if (progress_tick == ProgressTick::PROGRESS_TICK_ASYNC && !connected) {
+            tree->connect("process_frame", start_callable);
+        } else if (progress_tick != ProgressTick::PROGRESS_TICK_ASYNC && connected) {
+            tree->disconnect("process_frame", start_callable);
+        }
+    }
+
+    void FlecsWorld::apply_progress_tick_pipeline() {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+
+        // These modes run the presentation phases separately, with run_pipeline(), so world.progress() only runs the simulation.
+        const bool split_pipelines = progress_tick == ProgressTick::PROGRESS_TICK_FIXED || progress_tick == ProgressTick::PROGRESS_TICK_SPLIT ||
+                                     progress_tick == ProgressTick::PROGRESS_TICK_ASYNC;
+        if (progress_tick == ProgressTick::PROGRESS_TICK_ASYNC) {
+            // The MainThreadSystem systems run separately, on the main thread, before and after each step (see progress_async_step()).
+            world.set_pipeline(AsyncSimulationPipeline);
+        } else {
+            world.set_pipeline(split_pipelines ? SimulationPipeline : default_pipeline);
+        }
+        // The asynchronous simulation runs once per displayed frame, so there is nothing to interpolate between.
+        interpolation::set_snapshots_enabled(world, split_pipelines && progress_tick != ProgressTick::PROGRESS_TICK_ASYNC);
+
+        fixed_time_accumulator = 0.0;
+        interpolation_alpha = 1.0;
+        world.set<interpolation::InterpolationAlpha>({1.0f});
+    }
+
+    void FlecsWorld::set_fixed_tick_rate(double p_fixed_tick_rate) {
+        if (unlikely(p_fixed_tick_rate <= 0.0)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_fixed_tick_rate: the tick rate must be positive, got ") +
+                                                  godot::String::num(p_fixed_tick_rate));
+            return;
+        }
+        fixed_tick_rate = p_fixed_tick_rate;
+    }
+
+    void FlecsWorld::set_max_substeps(int p_max_substeps) {
+        if (unlikely(p_max_substeps < 1)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_max_substeps: at least one substep is required, got ") +
+                                                  godot::String::num_int64(p_max_substeps));
+            return;
+        }
+        max_substeps = p_max_substeps;
+    }
+
+    void FlecsWorld::progress_fixed(double delta) {
+        const double tick_duration = 1.0 / fixed_tick_rate;
+        fixed_time_accumulator += delta;
+
+        // The world runs SimulationPipeline in this mode, so every world.progress() is one fixed tick.
+        int substeps = 0;
+        while (fixed_time_accumulator >= tick_duration && substeps < max_substeps) {
+            world.progress(static_cast<ecs_ftime_t>(tick_duration));
+            fixed_time_accumulator -= tick_duration;
+            ++substeps;
+        }
+        if (fixed_time_accumulator >= tick_duration) {
+            fixed_time_accumulator = std::fmod(fixed_time_accumulator, tick_duration);
+        }
+
+        run_presentation(delta, fixed_time_accumulator / tick_duration);
+    }
+
+    void FlecsWorld::run_presentation(double delta, double alpha) {
+        interpolation_alpha = alpha;
+        world.set<interpolation::InterpolationAlpha>({static_cast<float>(interpolation_alpha)});
+
+        // run_pipeline() doesn't advance the world time, which only moves with the simulation ticks.
+        world.run_pipeline(PresentationPipeline, static_cast<ecs_ftime_t>(delta));
+    }
+
+    void FlecsWorld::progress_simulation(double delta) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+
+        refresh_signal_listeners();
+        world.progress(static_cast<ecs_ftime_t>(delta));
+        finish_progress();
+    }
+
+    void FlecsWorld::progress_presentation(double delta) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+
+        refresh_signal_listeners();
+        // Godot keeps the fraction of the physics tick that has elapsed at this frame, which is exactly the interpolation alpha.
+        run_presentation(delta, godot::Engine::get_singleton()->get_physics_interpolation_fraction());
+        finish_progress();
+    }
+
+    void FlecsWorld::start_async_simulation() {
+        if (unlikely(!is_initialised || progress_tick != ProgressTick::PROGRESS_TICK_ASYNC)) {
+            return;
+        }
+
+        refresh_signal_listeners();
+        const ecs_ftime_t delta = static_cast<ecs_ftime_t>(get_process_delta_time());
+        // The systems that call Godot servers can't run on the simulation thread. The ones before OnUpdate run now, the others once the step
+        // has been joined in progress_async_presentation().
+        world.run_pipeline(MainThreadPreUpdatePipeline, delta);
+        simulation_thread.start([this, delta]() { world.progress(delta); });
+        async_simulation_started = true;
+    }
+
+    void FlecsWorld::progress_async_presentation(double delta) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+
+        simulation_thread.wait();
+        if (likely(async_simulation_started)) {
+            world.run_pipeline(MainThreadPostUpdatePipeline, static_cast<ecs_ftime_t>(delta));
+        } else {
+            // The mode was switched to PROGRESS_TICK_ASYNC during this frame, after process_frame was emitted.
+            refresh_signal_listeners();
+            progress_async_step(delta);
+        }
+        async_simulation_started = false;
+
+        run_presentation(delta, 1.0);
+        finish_progress();
+    }
+
+    void FlecsWorld::progress_async_step(double delta) {
+        world.run_pipeline(MainThreadPreUpdatePipeline, static_cast<ecs_ftime_t>(delta));
+        world.progress(static_cast<ecs_ftime_t>(delta));
+        world.run_pipeline(MainThreadPostUpdatePipeline, static_cast<ecs_ftime_t>(delta));
+    }
+
+    void FlecsWorld::wait_for_simulation() const { simulation_thread.wait(); }
+
+    void FlecsWorld::set_max_parallelism(int p_max_parallelism) {
+        if (unlikely(p_max_parallelism < 0)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_max_parallelism: the parallelism can't be negative, got ") +
+                                                  godot::String::num_int64(p_max_parallelism));
+            return;
+        }
+        max_parallelism = p_max_parallelism;
+
+        // The number of stages can't change while a simulation step runs.
+        wait_for_simulation();
+        apply_max_parallelism();
+    }
+
+    godot::Dictionary FlecsWorld::get_system_parallelism_stats() {
+        godot::Dictionary stats;
+        if (unlikely(!is_initialised)) {
+            return stats;
+        }
+        wait_for_simulation();
+
+        // The multi-threaded variant carries the policy and is disabled while the single-threaded one runs, so match disabled systems too.
+        flecs::query<const ParallelismPolicy> query = world.query_builder<const ParallelismPolicy>().with(flecs::Disabled).optional().build();
+        query.each([&stats](flecs::entity system, const ParallelismPolicy &policy) {
+            godot::Dictionary system_stats;
+            system_stats["min_entities"] = policy.min_entities;
+            system_stats["processed_entities"] = policy.processed_entities;
+            system_stats["multi_threaded"] = policy.multi_threaded;
+            system_stats["switches"] = policy.switches;
+            system_stats["user_disabled"] = policy.user_disabled;
+            stats[godot::String(system.path("::", "").c_str())] = system_stats;
+        });
+        return stats;
+    }
+
+    void FlecsWorld::set_phase_time_budget(const godot::String &phase, double budget_milliseconds) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+        wait_for_simulation();
+        if (unlikely(budget_milliseconds < 0.0)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_phase_time_budget: the budget can't be negative, got ") +
+                                                  godot::String::num(budget_milliseconds));
+            return;
+        }
+        const flecs::entity_t phase_entity = lookup_phase(phase, "set_phase_time_budget");
+        if (phase_entity == 0) {
+            return;
+        }
+        stagehand::set_phase_time_budget(world, phase_entity, budget_milliseconds);
+    }
+
+    double FlecsWorld::get_phase_time_budget(const godot::String &phase) {
+        if (unlikely(!is_initialised)) {
+            return 0.0;
+        }
+        wait_for_simulation();
+        const flecs::entity_t phase_entity = lookup_phase(phase, "get_phase_time_budget");
+        return phase_entity == 0 ? 0.0 : stagehand::get_phase_time_budget(world, phase_entity);
+    }
+
+    godot::Dictionary FlecsWorld::get_time_sliced_system_stats() {
+        godot::Dictionary stats;
+        if (unlikely(!is_initialised)) {
+            return stats;
+        }
+        wait_for_simulation();
+
+        flecs::query<const TimeSlicedCursor> query = world.query_builder<const TimeSlicedCursor>().with(flecs::Disabled).optional().build();
+        query.each([&stats](flecs::entity system, const TimeSlicedCursor &cursor) {
+            godot::Dictionary system_stats;
+            system_stats["processed_entities"] = cursor.processed_entities;
+            system_stats["completed_passes"] = cursor.completed_passes;
+            system_stats["in_pass"] = cursor.table != nullptr;
+            stats[godot::String(system.path("::", "").c_str())] = system_stats;
+        });
+        return stats;
+    }
+
+    void FlecsWorld::set_system_update_rate(const godot::String &system, double rate) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+        wait_for_simulation();
+        if (unlikely(rate < 0.0)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_system_update_rate: the rate can't be negative, got ") +
+                                                  godot::String::num(rate));
+            return;
+        }
+        const flecs::entity_t system_entity = lookup_system(system, "set_system_update_rate");
+        if (system_entity == 0) {
+            return;
+        }
+        stagehand::set_system_update_rate(world, system_entity, rate);
+    }
+
+    double FlecsWorld::get_system_update_rate(const godot::String &system) {
+        if (unlikely(!is_initialised)) {
+            return 0.0;
+        }
+        wait_for_simulation();
+        const flecs::entity_t system_entity = lookup_system(system, "get_system_update_rate");
+        return system_entity == 0 ? 0.0 : stagehand::get_system_update_rate(world, system_entity);
+    }
+
+    void FlecsWorld::set_system_stagger(const godot::String &system, int slices) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+        wait_for_simulation();
+        if (unlikely(slices < 1)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_system_stagger: a system needs at least 1 slice, got ") +
+                                                  godot::String::num_int64(slices));
+            return;
+        }
+        const flecs::entity_t system_entity = lookup_system(system, "set_system_stagger");
+        if (system_entity == 0) {
+            return;
+        }
+        if (unlikely(!world.entity(system_entity).has<Stagger>())) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_system_stagger: ") + system + " isn't a staggered system");
+            return;
+        }
+        stagehand::set_system_stagger(world, system_entity, slices);
+    }
+
+    int FlecsWorld::get_system_stagger(const godot::String &system) {
+        if (unlikely(!is_initialised)) {
+            return 0;
+        }
+        wait_for_simulation();
+        const flecs::entity_t system_entity = lookup_system(system, "get_system_stagger");
+        return system_entity == 0 ? 0 : stagehand::get_system_stagger(world, system_entity);
+    }
+
+    void FlecsWorld::set_simulation_lod_reference_point(const godot::Vector3 &p_reference_point) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+        // The tier assignment systems read the settings while the simulation step runs.
+        wait_for_simulation();
+        world.get_mut<lod::SimulationLodSettings>().reference_point = p_reference_point;
+    }
+
+    godot::Vector3 FlecsWorld::get_simulation_lod_reference_point() const {
+        if (unlikely(!is_initialised)) {
+            return lod::SimulationLodSettings().reference_point;
+        }
+        wait_for_simulation();
+        return world.get<lod::SimulationLodSettings>().reference_point;
+    }
+
+    void FlecsWorld::set_simulation_lod_distances(const godot::PackedFloat32Array &p_distances) {
+        if (unlikely(!is_initialised)) {
+            return;
+        }
+        if (unlikely(p_distances.size() != lod::TIER_COUNT - 1)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_simulation_lod_distances: expected ") +
+                                                  godot::String::num_int64(lod::TIER_COUNT - 1) + " distances, got " +
+                                                  godot::String::num_int64(p_distances.size()));
+            return;
+        }
+        for (int64_t i = 1; i < p_distances.size(); ++i) {
+            if (unlikely(p_distances[i] < p_distances[i - 1])) {
+                godot::UtilityFunctions::push_warning("FlecsWorld::set_simulation_lod_distances: the distances have to be in increasing order");
+                return;
+            }
+        }
+
+        wait_for_simulation();
+        lod::SimulationLodSettings &settings = world.get_mut<lod::SimulationLodSettings>();
+        for (int64_t i = 0; i < p_distances.size(); ++i) {
+            settings.tier_distances[static_cast<size_t>(i)] = p_distances[i];
+        }
+    }
+
+    godot::PackedFloat32Array FlecsWorld::get_simulation_lod_distances() const {
+        const lod::SimulationLodSettings default_settings;
+        const lod::SimulationLodSettings *settings = &default_settings;
+        if (likely(is_initialised)) {
+            wait_for_simulation();
+            settings = &world.get<lod::SimulationLodSettings>();
+        }
+        godot::PackedFloat32Array distances;
+        for (float distance : settings->tier_distances) {
+            distances.push_back(distance);
+        }
+        return distances;
+    }
+
+    int64_t FlecsWorld::get_task_count() const {
+        if (unlikely(!is_initialised)) {
+            return 0;
+        }
+        wait_for_simulation();
+        return stagehand::get_task_count(world);
+    }
+
+    flecs::entity_t FlecsWorld::lookup_phase(const godot::String &phase, const char *caller) {
+        const flecs::entity phase_entity = world.lookup(phase.utf8().get_data());
+        if (unlikely(!phase_entity.is_valid() || !phase_entity.has(flecs::Phase))) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::") + caller + ": no pipeline phase named " + phase);
+            return 0;
+        }
+        return phase_entity.id();
+    }
+
+    flecs::entity_t FlecsWorld::lookup_system(const godot::String &system, const char *caller) {
+        const flecs::entity system_entity = world.lookup(system.utf8().get_data());
+        if (unlikely(!system_entity.is_valid() || !system_entity.has(flecs::System))) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::") + caller + ": no system named " + system);
+            return 0;
+        }
+        return system_entity.id();
+    }
+
+    void FlecsWorld::apply_max_parallelism() {
+        const int thread_count = max_parallelism > 0 ? max_parallelism : static_cast<int>(::utilities::Platform::get_thread_count());
+        ::utilities::WorkerThreadPoolTasks::release(worker_thread_pool_workers);
+        worker_thread_pool_workers = 0;
+        if (!use_worker_thread_pool) {
+            world.set_threads(thread_count);
+            prepare_event_queues(world);
+            return;
+        }
+
+        // The calling thread is one of the threads, so the world needs one pool thread less. A world that finds fewer free pool threads than
+        // it asks for makes do with those, down to running single-threaded: threads of its own would oversubscribe the cores again.
+        const int workers = thread_count - 1;
+        const int granted = ::utilities::WorkerThreadPoolTasks::claim(workers);
+        if (unlikely(max_parallelism > 0 && granted < workers)) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::set_max_parallelism: only ") + godot::String::num_int64(granted + 1) +
+                                                  " of " + godot::String::num_int64(thread_count) +
+                                                  " threads are free in the WorkerThreadPool, the world runs on that many");
+        }
+        worker_thread_pool_workers = granted;
+        world.set_task_threads(granted + 1);
+        // The new stages need their event lanes before the presentation pipeline runs, which doesn't include PreFrame.
+        prepare_event_queues(world);
+    }
+
+    void FlecsWorld::finish_progress() {
+        // Typed events are only converted into Dictionaries here, and only for event types that have a Godot listener.
+        drain_typed_events(world, &typed_event_forwarder);
+
+        if (signal_batching) {
+            flush_batched_signals();
         }
     }
 
@@ -319,10 +1273,24 @@ namespace stagehand {
             return;
         }
 
-        world.progress(static_cast<ecs_ftime_t>(delta));
+        wait_for_simulation();
+        refresh_signal_listeners();
+        if (progress_tick == ProgressTick::PROGRESS_TICK_FIXED) {
+            progress_fixed(delta);
+        } else if (progress_tick == ProgressTick::PROGRESS_TICK_SPLIT) {
+            world.progress(static_cast<ecs_ftime_t>(delta));
+            run_presentation(delta, 1.0);
+        } else if (progress_tick == ProgressTick::PROGRESS_TICK_ASYNC) {
+            progress_async_step(delta);
+            run_presentation(delta, 1.0);
+        } else {
+            world.progress(static_cast<ecs_ftime_t>(delta));
+        }
+        finish_progress();
     }
 
     void FlecsWorld::set_world_configuration(const godot::TypedDictionary<godot::String, godot::Variant> &p_configuration) {
+        wait_for_simulation();
         const godot::TypedDictionary<godot::String, godot::Variant> previous_configuration = world_configuration;
 
         // Avoid self-assignment which can crash
@@ -345,6 +1313,7 @@ namespace stagehand {
     }
 
     godot::TypedDictionary<godot::String, godot::Variant> FlecsWorld::get_world_configuration() const {
+        wait_for_simulation();
         if (godot::Engine::get_singleton()->is_editor_hint()) {
             return world_configuration;
         }
@@ -392,7 +1361,7 @@ namespace stagehand {
         godot::TypedArray<Node> child_nodes = get_children();
         for (int i = 0; i < child_nodes.size(); ++i) {
             if (auto ir3d = godot::Object::cast_to<InstancedRenderer3D>(child_nodes[i])) {
-                register_instanced_renderer(world, ir3d, renderers, renderer_count);
+                register_instanced_renderer(world, prefab_registry, ir3d, renderers, renderer_count);
             }
         }
 
@@ -433,9 +1402,9 @@ namespace stagehand {
         for (int i = 0; i < child_nodes.size(); ++i) {
             // Only register nodes which are MultiMeshRenderer2D or MultiMeshRenderer3D
             if (auto mm2d = godot::Object::cast_to<MultiMeshRenderer2D>(child_nodes[i])) {
-                register_multimesh_renderer(world, mm2d, renderers, renderer_count);
+                register_multimesh_renderer(world, prefab_registry, mm2d, renderers, renderer_count);
             } else if (auto mm3d = godot::Object::cast_to<MultiMeshRenderer3D>(child_nodes[i])) {
-                register_multimesh_renderer(world, mm3d, renderers, renderer_count);
+                register_multimesh_renderer(world, prefab_registry, mm3d, renderers, renderer_count);
             }
         }
 
@@ -456,11 +1425,189 @@ namespace stagehand {
             .each([this](flecs::iter &it, size_t index) {
                 const EventPayload *signal = it.param<EventPayload>();
                 if (likely(signal)) {
-                    this->emit_signal("stagehand_signal_emitted", signal->name, signal->data);
+                    this->forward_event(*signal);
                 }
             });
     }
 
+    void FlecsWorld::forward_event(const EventPayload &payload) {
+        dispatch_event(payload);
+        // Nobody listens to the catch-all signal, so skip marshalling the payload to the script side altogether.
+        if (!has_signal_listeners) {
+            return;
+        }
+        if (signal_batching) {
+            buffer_signal(payload);
+        } else {
+            emit_signal("stagehand_signal_emitted", payload.name, payload.data);
+        }
+    }
+
+    bool FlecsWorld::TypedEventForwarder::wants(size_t event_type_index) const {
+        return owner->has_signal_listeners || owner->event_subscribers.contains(owner->typed_event_names[event_type_index]);
+    }
+
+    void FlecsWorld::TypedEventForwarder::deliver(size_t event_type_index, const godot::Dictionary &data, flecs::entity_t source_entity_id) {
+        EventPayload payload;
+        payload.name = owner->typed_event_names[event_type_index];
+        payload.data = data;
+        payload.source_entity_id = static_cast<uint64_t>(source_entity_id);
+        owner->forward_event(payload);
+    }
+
+    void FlecsWorld::refresh_signal_listeners() {
+        has_signal_listeners = has_connections(signal_batching ? "stagehand_signals_emitted" : "stagehand_signal_emitted");
+    }
+
+    void FlecsWorld::dispatch_event(const EventPayload &payload) {
+        const auto subscribers_it = event_subscribers.find(payload.name);
+        if (subscribers_it == event_subscribers.end()) {
+            return;
+        }
+
+        // Subscribers may connect or disconnect from inside their callback, so iterate over a copy.
+        const std::vector<godot::Callable> subscribers = subscribers_it->second;
+        bool has_invalid_subscribers = false;
+        for (const godot::Callable &callable : subscribers) {
+            if (unlikely(!callable.is_valid())) {
+                has_invalid_subscribers = true;
+                continue;
+            }
+            callable.call(payload.data, static_cast<int64_t>(payload.source_entity_id));
+        }
+
+        // Drop callables whose object was freed without disconnecting.
+        if (unlikely(has_invalid_subscribers)) {
+            if (const auto it = event_subscribers.find(payload.name); it != event_subscribers.end()) {
+                std::erase_if(it->second, [](const godot::Callable &callable) { return !callable.is_valid(); });
+                if (it->second.empty()) {
+                    event_subscribers.erase(it);
+                }
+            }
+        }
+    }
+
+    void FlecsWorld::connect_event(const godot::StringName &event_name, const godot::Callable &callable) {
+        wait_for_simulation();
+        if (unlikely(!callable.is_valid())) {
+            godot::UtilityFunctions::push_warning(godot::String("FlecsWorld::connect_event called with an invalid callable for event '") + event_name + "'");
+            return;
+        }
+
+        std::vector<godot::Callable> &subscribers = event_subscribers[event_name];
+        if (unlikely(std::find(subscribers.begin(), subscribers.end(), callable) != subscribers.end())) {
+            godot::UtilityFunctions::push_warning(godot::String("Callable is already connected to event '") + event_name + "'");
+            return;
+        }
+        subscribers.push_back(callable);
+    }
+
+    void FlecsWorld::disconnect_event(const godot::StringName &event_name, const godot::Callable &callable) {
+        wait_for_simulation();
+        const auto subscribers_it = event_subscribers.find(event_name);
+        if (subscribers_it != event_subscribers.end()) {
+            std::vector<godot::Callable> &subscribers = subscribers_it->second;
+            if (const auto it = std::find(subscribers.begin(), subscribers.end(), callable); it != subscribers.end()) {
+                subscribers.erase(it);
+                if (subscribers.empty()) {
+                    event_subscribers.erase(subscribers_it);
+                }
+                return;
+            }
+        }
+        godot::UtilityFunctions::push_warning(godot::String("Callable is not connected to event '") + event_name + "'");
+    }
+
+    bool FlecsWorld::is_event_connected(const godot::StringName &event_name, const godot::Callable &callable) const {
+        wait_for_simulation();
+        const auto subscribers_it = event_subscribers.find(event_name);
+        if (subscribers_it == event_subscribers.end()) {
+            return false;
+        }
+        return std::find(subscribers_it->second.begin(), subscribers_it->second.end(), callable) != subscribers_it->second.end();
+    }
+
+    void FlecsWorld::buffer_signal(const EventPayload &payload) {
+        auto [index_it, inserted] = signal_batch_indices.try_emplace(payload.name, signal_batches.size());
+        if (inserted) {
+            signal_batches.push_back({payload.name});
+        }
+        SignalBatch &batch = signal_batches[index_it->second];
+
+        const int64_t event_index = batch.count++;
+        batch.source_entity_ids.push_back(static_cast<int64_t>(payload.source_entity_id));
+
+        const godot::Array keys = payload.data.keys();
+        for (int64_t i = 0; i < keys.size(); ++i) {
+            const godot::Variant &key = keys[i];
+            godot::Array column;
+            if (batch.columns.has(key)) {
+                column = batch.columns[key];
+            } else {
+                // Keys first seen part-way through the frame get nulls for the earlier events, so rows stay aligned.
+                column.resize(event_index);
+                batch.columns[key] = column;
+            }
+            column.push_back(payload.data[key]);
+        }
+
+        // Pad the columns this event didn't provide a value for.
+        if (batch.columns.size() > keys.size()) {
+            const godot::Array columns = batch.columns.values();
+            for (int64_t i = 0; i < columns.size(); ++i) {
+                godot::Array column = columns[i];
+                if (column.size() < batch.count) {
+                    column.resize(batch.count);
+                }
+            }
+        }
+    }
+
+    void FlecsWorld::flush_batched_signals() {
+        if (signal_batches.empty()) {
+            return;
+        }
+
+        // Handlers may emit new events; those go into a fresh buffer and are delivered after the next progress().
+        std::vector<SignalBatch> batches = std::move(signal_batches);
+        signal_batches.clear();
+        signal_batch_indices.clear();
+
+        godot::PackedStringArray names;
+        godot::Array data;
+        names.resize(static_cast<int64_t>(batches.size()));
+        data.resize(static_cast<int64_t>(batches.size()));
+        for (size_t batch_index = 0; batch_index < batches.size(); ++batch_index) {
+            const SignalBatch &batch = batches[batch_index];
+
+            godot::Dictionary columns;
+            const godot::Array keys = batch.columns.keys();
+            for (int64_t i = 0; i < keys.size(); ++i) {
+                columns[keys[i]] = pack_signal_column(batch.columns[keys[i]]);
+            }
+
+            godot::Dictionary entry;
+            entry["count"] = batch.count;
+            entry["source_entity_ids"] = batch.source_entity_ids;
+            entry["columns"] = columns;
+
+            names.set(static_cast<int64_t>(batch_index), batch.name);
+            data[static_cast<int64_t>(batch_index)] = entry;
+        }
+
+        emit_signal("stagehand_signals_emitted", names, data);
+    }
+
+    void FlecsWorld::set_signal_batching(bool p_enabled) {
+        wait_for_simulation();
+        if (signal_batching && !p_enabled) {
+            // Deliver whatever was buffered so that turning batching off never drops events.
+            flush_batched_signals();
+        }
+        signal_batching = p_enabled;
+        refresh_signal_listeners();
+    }
+
     void FlecsWorld::import_configured_modules() {
         for (int i = 0; i < modules_to_import.size(); ++i) {
             godot::String module_entry = modules_to_import[i];
@@ -486,6 +1633,9 @@ namespace stagehand {
         register_signal_observer();
         import_configured_modules();
         script_loader.run_all(world, modules_to_import);
+        // Scripts may have (re)defined prefabs, so any cached prefab entity could now be stale.
+        prefab_registry.invalidate();
+        release_column_queries();
         set_world_configuration(world_configuration);
         set_progress_tick(progress_tick);
 
@@ -509,14 +1659,20 @@ namespace stagehand {
     void FlecsWorld::_ready() { run_post_tree_setup(); }
 
     void FlecsWorld::_process(double p_delta) {
-        if (progress_tick == ProgressTick::PROGRESS_TICK_RENDERING) {
+        if (progress_tick == ProgressTick::PROGRESS_TICK_RENDERING || progress_tick == ProgressTick::PROGRESS_TICK_FIXED) {
             progress(p_delta);
+        } else if (progress_tick == ProgressTick::PROGRESS_TICK_SPLIT) {
+            progress_presentation(p_delta);
+        } else if (progress_tick == ProgressTick::PROGRESS_TICK_ASYNC) {
+            progress_async_presentation(p_delta);
         }
     }
 
     void FlecsWorld::_physics_process(double p_delta) {
         if (progress_tick == ProgressTick::PROGRESS_TICK_PHYSICS) {
             progress(p_delta);
+        } else if (progress_tick == ProgressTick::PROGRESS_TICK_SPLIT) {
+            progress_simulation(p_delta);
         }
     }
 
@@ -524,6 +1680,13 @@ namespace stagehand {
         enter_tree_setup_completed = false;
         post_tree_setup_completed = false;
 
+        wait_for_simulation();
+        async_simulation_started = false;
+        const godot::Callable start_callable = callable_mp(this, &FlecsWorld::start_async_simulation);
+        if (is_inside_tree() && get_tree()->is_connected("process_frame", start_callable)) {
+            get_tree()->disconnect("process_frame", start_callable);
+        }
+
         if (is_initialised) {
             cleanup_instanced_renderer_rids();
             is_initialised = false;
@@ -536,16 +1699,41 @@ namespace stagehand {
         godot::ClassDB::bind_method(godot::D_METHOD("has_component", "component_name", "entity_id"), &FlecsWorld::has_component, DEFVAL(0));
         godot::ClassDB::bind_method(godot::D_METHOD("add_component", "component_name", "entity_id"), &FlecsWorld::add_component, DEFVAL(0));
         godot::ClassDB::bind_method(godot::D_METHOD("remove_component", "component_name", "entity_id"), &FlecsWorld::remove_component, DEFVAL(0));
+        godot::ClassDB::bind_method(godot::D_METHOD("set_components_bulk", "component_name", "entity_ids", "values"), &FlecsWorld::set_components_bulk);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_component_column", "component_name", "query_or_prefab"), &FlecsWorld::get_component_column,
+                                    DEFVAL(godot::Variant()));
+
+        godot::ClassDB::bind_method(godot::D_METHOD("create_query", "terms"), &FlecsWorld::create_query);
+
+        godot::ClassDB::bind_method(godot::D_METHOD("get_component_handle", "component_name"), &FlecsWorld::get_component_handle);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_component_by_handle", "component_handle", "data", "entity_id"), &FlecsWorld::set_component_by_handle,
+                                    DEFVAL(0));
+        godot::ClassDB::bind_method(godot::D_METHOD("get_component_by_handle", "component_handle", "entity_id"), &FlecsWorld::get_component_by_handle, DEFVAL(0));
+        godot::ClassDB::bind_method(godot::D_METHOD("has_component_by_handle", "component_handle", "entity_id"), &FlecsWorld::has_component_by_handle, DEFVAL(0));
+        godot::ClassDB::bind_method(godot::D_METHOD("add_component_by_handle", "component_handle", "entity_id"), &FlecsWorld::add_component_by_handle, DEFVAL(0));
+        godot::ClassDB::bind_method(godot::D_METHOD("remove_component_by_handle", "component_handle", "entity_id"), &FlecsWorld::remove_component_by_handle,
+                                    DEFVAL(0));
+        godot::ClassDB::bind_method(godot::D_METHOD("set_components_bulk_by_handle", "component_handle", "entity_ids", "values"),
+                                    &FlecsWorld::set_components_bulk_by_handle);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_component_column_by_handle", "component_handle", "query_or_prefab"),
+                                    &FlecsWorld::get_component_column_by_handle, DEFVAL(godot::Variant()));
 
         godot::ClassDB::bind_method(godot::D_METHOD("enable_entity", "entity_id", "enabled"), &FlecsWorld::enable_entity, DEFVAL(true));
+        godot::ClassDB::bind_method(godot::D_METHOD("set_entities_enabled", "entity_ids", "enabled"), &FlecsWorld::set_entities_enabled, DEFVAL(true));
         godot::ClassDB::bind_method(godot::D_METHOD("run_system", "system", "data"), &FlecsWorld::run_system, DEFVAL(Dictionary()));
 
         godot::ClassDB::bind_method(godot::D_METHOD("create_entity", "name"), &FlecsWorld::create_entity, DEFVAL(""));
         godot::ClassDB::bind_method(godot::D_METHOD("destroy_entity", "entity_id"), &FlecsWorld::destroy_entity);
+        godot::ClassDB::bind_method(godot::D_METHOD("destroy_entities", "entity_ids"), &FlecsWorld::destroy_entities);
         godot::ClassDB::bind_method(godot::D_METHOD("is_alive", "entity_id"), &FlecsWorld::is_alive);
         godot::ClassDB::bind_method(godot::D_METHOD("lookup", "name"), &FlecsWorld::lookup);
         godot::ClassDB::bind_method(godot::D_METHOD("get_entity_name", "entity_id"), &FlecsWorld::get_entity_name);
         godot::ClassDB::bind_method(godot::D_METHOD("instantiate_prefab", "prefab_name", "components"), &FlecsWorld::instantiate_prefab, DEFVAL(Dictionary()));
+        godot::ClassDB::bind_method(godot::D_METHOD("get_prefab_handle", "prefab_name"), &FlecsWorld::get_prefab_handle);
+        godot::ClassDB::bind_method(godot::D_METHOD("instantiate_prefab_by_handle", "prefab_handle", "components"), &FlecsWorld::instantiate_prefab_by_handle,
+                                    DEFVAL(Dictionary()));
+        godot::ClassDB::bind_method(godot::D_METHOD("instantiate_prefab_batch", "prefab_name", "count", "components"), &FlecsWorld::instantiate_prefab_batch,
+                                    DEFVAL(Dictionary()));
 
         godot::ClassDB::bind_method(godot::D_METHOD("emit_event", "event_name", "data", "source_entity_id"), &FlecsWorld::emit_event, DEFVAL(Dictionary()),
                                     DEFVAL(0));
@@ -553,6 +1741,27 @@ namespace stagehand {
         godot::ClassDB::bind_method(godot::D_METHOD("set_progress_tick", "progress_tick"), &FlecsWorld::set_progress_tick);
         godot::ClassDB::bind_method(godot::D_METHOD("get_progress_tick"), &FlecsWorld::get_progress_tick);
         godot::ClassDB::bind_method(godot::D_METHOD("progress", "delta"), &FlecsWorld::progress);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_fixed_tick_rate", "fixed_tick_rate"), &FlecsWorld::set_fixed_tick_rate);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_fixed_tick_rate"), &FlecsWorld::get_fixed_tick_rate);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_max_substeps", "max_substeps"), &FlecsWorld::set_max_substeps);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_max_substeps"), &FlecsWorld::get_max_substeps);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_interpolation_alpha"), &FlecsWorld::get_interpolation_alpha);
+        godot::ClassDB::bind_method(godot::D_METHOD("wait_for_simulation"), &FlecsWorld::wait_for_simulation);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_max_parallelism", "max_parallelism"), &FlecsWorld::set_max_parallelism);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_max_parallelism"), &FlecsWorld::get_max_parallelism);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_system_parallelism_stats"), &FlecsWorld::get_system_parallelism_stats);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_phase_time_budget", "phase", "budget_milliseconds"), &FlecsWorld::set_phase_time_budget);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_phase_time_budget", "phase"), &FlecsWorld::get_phase_time_budget);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_time_sliced_system_stats"), &FlecsWorld::get_time_sliced_system_stats);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_task_count"), &FlecsWorld::get_task_count);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_simulation_lod_reference_point", "reference_point"), &FlecsWorld::set_simulation_lod_reference_point);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_simulation_lod_reference_point"), &FlecsWorld::get_simulation_lod_reference_point);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_simulation_lod_distances", "distances"), &FlecsWorld::set_simulation_lod_distances);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_simulation_lod_distances"), &FlecsWorld::get_simulation_lod_distances);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_system_update_rate", "system", "rate"), &FlecsWorld::set_system_update_rate);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_system_update_rate", "system"), &FlecsWorld::get_system_update_rate);
+        godot::ClassDB::bind_method(godot::D_METHOD("set_system_stagger", "system", "slices"), &FlecsWorld::set_system_stagger);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_system_stagger", "system"), &FlecsWorld::get_system_stagger);
 
         godot::ClassDB::bind_method(godot::D_METHOD("set_world_configuration", "configuration"), &FlecsWorld::set_world_configuration);
         godot::ClassDB::bind_method(godot::D_METHOD("get_world_configuration"), &FlecsWorld::get_world_configuration);
@@ -560,11 +1769,29 @@ namespace stagehand {
         godot::ClassDB::bind_method(godot::D_METHOD("set_modules_to_import", "modules"), &FlecsWorld::set_modules_to_import);
         godot::ClassDB::bind_method(godot::D_METHOD("get_modules_to_import"), &FlecsWorld::get_modules_to_import);
 
-        ADD_PROPERTY(godot::PropertyInfo(godot::Variant::INT, "progress_tick", godot::PROPERTY_HINT_ENUM, "Rendering,Physics,Manual"), "set_progress_tick",
+        ADD_PROPERTY(godot::PropertyInfo(godot::Variant::INT, "progress_tick", godot::PROPERTY_HINT_ENUM, "Rendering,Physics,Manual,Fixed,Split,Async"), "set_progress_tick",
                      "get_progress_tick");
+        ADD_PROPERTY(godot::PropertyInfo(godot::Variant::FLOAT, "fixed_tick_rate", godot::PROPERTY_HINT_RANGE, "1,240,1,or_greater,suffix:Hz"),
+                     "set_fixed_tick_rate", "get_fixed_tick_rate");
+        ADD_PROPERTY(godot::PropertyInfo(godot::Variant::INT, "max_parallelism", godot::PROPERTY_HINT_RANGE, "0,64,1,or_greater"), "set_max_parallelism",
+                     "get_max_parallelism");
+        ADD_PROPERTY(godot::PropertyInfo(godot::Variant::INT, "max_substeps", godot::PROPERTY_HINT_RANGE, "1,16,1,or_greater"), "set_max_substeps",
+                     "get_max_substeps");
+        ADD_PROPERTY(godot::PropertyInfo(godot::Variant::PACKED_FLOAT32_ARRAY, "simulation_lod_distances"), "set_simulation_lod_distances",
+                     "get_simulation_lod_distances");
+        godot::ClassDB::bind_method(godot::D_METHOD("connect_event", "event_name", "callable"), &FlecsWorld::connect_event);
+        godot::ClassDB::bind_method(godot::D_METHOD("disconnect_event", "event_name", "callable"), &FlecsWorld::disconnect_event);
+        godot::ClassDB::bind_method(godot::D_METHOD("is_event_connected", "event_name", "callable"), &FlecsWorld::is_event_connected);
+
+        godot::ClassDB::bind_method(godot::D_METHOD("set_signal_batching", "enabled"), &FlecsWorld::set_signal_batching);
+        godot::ClassDB::bind_method(godot::D_METHOD("get_signal_batching"), &FlecsWorld::get_signal_batching);
+
         BIND_ENUM_CONSTANT(PROGRESS_TICK_RENDERING);
         BIND_ENUM_CONSTANT(PROGRESS_TICK_PHYSICS);
         BIND_ENUM_CONSTANT(PROGRESS_TICK_MANUAL);
+        BIND_ENUM_CONSTANT(PROGRESS_TICK_FIXED);
+        BIND_ENUM_CONSTANT(PROGRESS_TICK_SPLIT);
+        BIND_ENUM_CONSTANT(PROGRESS_TICK_ASYNC);
 
         ADD_PROPERTY(godot::PropertyInfo(godot::Variant::DICTIONARY, "world_configuration", godot::PROPERTY_HINT_TYPE_STRING,
                                          godot::String::num_int64(godot::Variant::STRING) + "/" + godot::String::num_int64(godot::PROPERTY_HINT_NONE) + ":",
@@ -576,9 +1803,21 @@ namespace stagehand {
                                          godot::PROPERTY_USAGE_DEFAULT),
                      "set_modules_to_import", "get_modules_to_import");
 
+        ADD_PROPERTY(godot::PropertyInfo(godot::Variant::BOOL, "signal_batching"), "set_signal_batching", "get_signal_batching");
+
         ADD_SIGNAL(godot::MethodInfo("stagehand_signal_emitted", godot::PropertyInfo(godot::Variant::STRING_NAME, "name"),
                                      godot::PropertyInfo(godot::Variant::DICTIONARY, "data")));
+        ADD_SIGNAL(godot::MethodInfo("stagehand_signals_emitted", godot::PropertyInfo(godot::Variant::PACKED_STRING_ARRAY, "names"),
+                                     godot::PropertyInfo(godot::Variant::ARRAY, "data")));
     }
 
-    FlecsWorld::~FlecsWorld() {}
+    FlecsWorld::~FlecsWorld() {
+        simulation_thread.stop();
+        ::utilities::WorkerThreadPoolTasks::release(worker_thread_pool_workers);
+        release_column_queries();
+        // Queries can outlive the world on the script side; release their Flecs resources while the world still exists.
+        while (!live_queries.empty()) {
+            (*live_queries.begin())->release();
+        }
+    }
 } // namespace stagehand
@@ -1,21 +1,31 @@
 #pragma once
 
-#include <functional>
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <godot_cpp/classes/control.hpp>
 #include <godot_cpp/classes/directional_light2d.hpp>
 #include <godot_cpp/classes/mesh_instance2d.hpp>
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 #include <godot_cpp/variant/typed_dictionary.hpp>
 
 #include "flecs.h"
 
+#include "stagehand/ecs/components/event_payload.h"
+#include "stagehand/ecs/components/typed_event.h"
+#include "stagehand/prefab_registry.h"
+#include "stagehand/query.h"
+#include "stagehand/registry.h"
 #include "stagehand/script_loader.h"
 #include "stagehand/utilities/godot_hashes.h" // IWYU pragma: keep
+#include "stagehand/utilities/simulation_thread.h"
 
 namespace stagehand {
     /// The main FlecsWorld node that integrates Flecs with Godot.
@@ -23,6 +33,7 @@ namespace stagehand {
         GDCLASS(FlecsWorld, godot::Node)
 
         friend class Prefab;
+        friend class FlecsQuery;
 
       public:
         enum ProgressTick {
@@ -33,7 +44,16 @@ namespace stagehand {
             PROGRESS_TICK_PHYSICS,
             /// No world.progress() call happens in either rendering or physics
             /// tick; the world must be progressed manually.
-            PROGRESS_TICK_MANUAL
+            PROGRESS_TICK_MANUAL,
+            /// The simulation advances in fixed ticks of 1 / fixed_tick_rate seconds from _process(), and the presentation phases run once per
+            /// displayed frame with an interpolation alpha between the last two ticks.
+            PROGRESS_TICK_FIXED,
+            /// The simulation phases run in _physics_process() and the presentation phases (OnRender, PostRender) in _process(), so render
+            /// extraction happens every displayed frame while the simulation only runs at the physics tick rate.
+            PROGRESS_TICK_SPLIT,
+            /// The simulation phases run on a dedicated thread from the start of the frame, overlapping with the scene tree's own processing,
+            /// and are joined in _process() before the presentation phases run on the main thread.
+            PROGRESS_TICK_ASYNC
         };
 
       public:
@@ -50,9 +70,48 @@ namespace stagehand {
         void add_component(const godot::StringName &component_name, uint64_t entity_id = 0);
         /// Removes a component (or tag) from an entity.
         void remove_component(const godot::StringName &component_name, uint64_t entity_id = 0);
+        /// Sets a component value on many entities in one call.
+        /// @param component_name The name of a scalar or Godot variant component.
+        /// @param entity_ids The entities to write to.
+        /// @param values One value per entity, as the matching packed array (e.g. PackedFloat32Array, PackedVector2Array) or an Array.
+        /// @return The number of entities that were written.
+        int64_t set_components_bulk(const godot::StringName &component_name, const godot::PackedInt64Array &entity_ids, const godot::Variant &values);
+        /// Reads a component from every matching entity in one call.
+        /// @param component_name The name of a scalar or Godot variant component.
+        /// @param query_or_prefab A FlecsQuery created by this world, a prefab name to restrict the read to instances of that prefab, or null for all
+        /// entities with the component.
+        /// @return A dictionary with "entity_ids" (PackedInt64Array) and "values" (the packed array matching the component type).
+        [[nodiscard]] godot::Dictionary get_component_column(const godot::StringName &component_name, const godot::Variant &query_or_prefab = godot::Variant());
+
+        /// Creates a cached query that GDScript can iterate at table level.
+        /// @param terms Either a list of component names (all required, read-only) or a Flecs query DSL string, e.g. "Position2D, (IsA, MyPrefab)".
+        /// @return The query, or null if it could not be built.
+        [[nodiscard]] godot::Ref<FlecsQuery> create_query(const godot::Variant &terms);
+
+        /// Resolves a component name into an integer handle that the *_by_handle methods accept without any name hashing.
+        /// Handles are stable for the lifetime of the world.
+        /// @return The handle, or -1 if no component with that name is registered.
+        [[nodiscard]] int64_t get_component_handle(const godot::StringName &component_name) const;
+        /// Handle-based variant of set_component().
+        void set_component_by_handle(int64_t component_handle, const godot::Variant &data, uint64_t entity_id = 0);
+        /// Handle-based variant of get_component().
+        [[nodiscard]] godot::Variant get_component_by_handle(int64_t component_handle, uint64_t entity_id = 0);
+        /// Handle-based variant of has_component().
+        [[nodiscard]] bool has_component_by_handle(int64_t component_handle, uint64_t entity_id = 0);
+        /// Handle-based variant of add_component().
+        void add_component_by_handle(int64_t component_handle, uint64_t entity_id = 0);
+        /// Handle-based variant of remove_component().
+        void remove_component_by_handle(int64_t component_handle, uint64_t entity_id = 0);
+        /// Handle-based variant of set_components_bulk().
+        int64_t set_components_bulk_by_handle(int64_t component_handle, const godot::PackedInt64Array &entity_ids, const godot::Variant &values);
+        /// Handle-based variant of get_component_column().
+        [[nodiscard]] godot::Dictionary get_component_column_by_handle(int64_t component_handle, const godot::Variant &query_or_prefab = godot::Variant());
 
         /// Enables or disables an entity by ID.
         bool enable_entity(uint64_t entity_id, bool enabled = true);
+        /// Enables or disables many entities in one deferred batch.
+        /// @return The number of entities that were updated.
+        int64_t set_entities_enabled(const godot::PackedInt64Array &entity_ids, bool enabled = true);
         /// Runs a specific system manually, optionally with parameters.
         /// @param system The ID (int) or name (String) of the system to run.
         /// @param parameters A dictionary of parameters to pass to the system.
@@ -64,6 +123,9 @@ namespace stagehand {
         uint64_t create_entity(const godot::String &name = "");
         /// Destroys an entity.
         void destroy_entity(uint64_t entity_id);
+        /// Destroys many entities in one deferred batch.
+        /// @return The number of entities that were destroyed.
+        int64_t destroy_entities(const godot::PackedInt64Array &entity_ids);
         /// Checks if an entity is alive.
         [[nodiscard]] bool is_alive(uint64_t entity_id);
         /// Looks up an entity by name.
@@ -75,20 +137,91 @@ namespace stagehand {
         /// @param components A dictionary of component names to values to set on the instance.
         /// @return The entity ID of the new instance, or 0 if failed.
         uint64_t instantiate_prefab(const godot::StringName &prefab_name, const godot::Dictionary &components = {});
+        /// Resolves a prefab name into an integer handle that instantiate_prefab_by_handle() accepts without any name lookup.
+        /// Handles are stable for the lifetime of the world; the prefab they refer to is looked up again after scripts are reloaded.
+        /// @return The handle, or -1 if no prefab with that name exists.
+        [[nodiscard]] int64_t get_prefab_handle(const godot::StringName &prefab_name);
+        /// Handle-based variant of instantiate_prefab().
+        uint64_t instantiate_prefab_by_handle(int64_t prefab_handle, const godot::Dictionary &components = {});
+        /// Instantiates a prefab many times in one call.
+        /// @param prefab_name The name of the prefab to instantiate.
+        /// @param count The number of instances to create.
+        /// @param components A dictionary of component names to per-instance values (packed arrays or Arrays with `count` elements each).
+        /// @return The entity IDs of the new instances, or an empty array if failed.
+        godot::PackedInt64Array instantiate_prefab_batch(const godot::StringName &prefab_name, int64_t count, const godot::Dictionary &components = {});
 
         /// Emits a Stagehand event payload into Flecs. Intended to be called from GDScript.
         /// @param event_name Stored in EventPayload::name.
         /// @param data Stored in EventPayload::data.
         /// @param source_entity_id Optional source entity ID; uses an internal emitter when 0.
         void emit_event(const godot::StringName &event_name, const godot::Dictionary &data = {}, uint64_t source_entity_id = 0);
+        /// Subscribes a callable to one event name. It is called as callable(data: Dictionary, source_entity_id: int) for every matching event.
+        /// Unlike stagehand_signal_emitted, only events with this name reach the callable.
+        void connect_event(const godot::StringName &event_name, const godot::Callable &callable);
+        /// Removes a subscription made with connect_event().
+        void disconnect_event(const godot::StringName &event_name, const godot::Callable &callable);
+        /// Returns true if the callable is subscribed to the event name.
+        [[nodiscard]] bool is_event_connected(const godot::StringName &event_name, const godot::Callable &callable) const;
+
+        /// When enabled, Stagehand events are buffered during progress() and delivered as one stagehand_signals_emitted signal afterwards,
+        /// instead of one stagehand_signal_emitted signal per event.
+        void set_signal_batching(bool p_enabled);
+        [[nodiscard]] bool get_signal_batching() const { return signal_batching; }
 
         void set_progress_tick(ProgressTick p_progress_tick);
         ProgressTick get_progress_tick() const { return progress_tick; }
         /// Advances the ECS world by a delta time.
+        /// In PROGRESS_TICK_FIXED mode the delta is added to the fixed tick accumulator instead, and as many fixed ticks run as it holds.
+        /// In PROGRESS_TICK_SPLIT and PROGRESS_TICK_ASYNC modes one simulation step and one presentation pass run, both on the calling thread.
         /// @param delta The time elapsed since the last frame.
         /// @note Can be called from GDScript attached to the FlecsWorld node.
         void progress(double delta);
 
+        /// The number of simulation ticks per second in PROGRESS_TICK_FIXED mode.
+        void set_fixed_tick_rate(double p_fixed_tick_rate);
+        [[nodiscard]] double get_fixed_tick_rate() const { return fixed_tick_rate; }
+        /// The most fixed ticks that run in one frame. Time beyond that is dropped, so a slow frame doesn't make the next ones slower still.
+        void set_max_substeps(int p_max_substeps);
+        [[nodiscard]] int get_max_substeps() const { return max_substeps; }
+        /// How far the current frame is between the previous and the latest fixed (or physics) tick, in [0, 1).
+        /// 1 outside of PROGRESS_TICK_FIXED and PROGRESS_TICK_SPLIT modes.
+        [[nodiscard]] double get_interpolation_alpha() const { return interpolation_alpha; }
+        /// How many threads multi-threaded systems are split across, including the thread that progresses the world. 0 picks one per CPU
+        /// core but one. The worker tasks run on Godot's WorkerThreadPool, which all worlds share. A world only takes the pool threads the
+        /// other worlds left free, so it may run on fewer threads than this (see WorkerThreadPoolTasks::claim()).
+        void set_max_parallelism(int p_max_parallelism);
+        [[nodiscard]] int get_max_parallelism() const { return max_parallelism; }
+        /// Returns, for every system that picks its parallelism per frame (see register_adaptive_system()), a Dictionary with its
+        /// min_entities, the entities it processed in the previous frame, whether it currently runs multi-threaded, and how often it switched.
+        [[nodiscard]] godot::Dictionary get_system_parallelism_stats();
+        /// Caps how long the time-sliced systems in a pipeline phase (see register_time_sliced_system()) may run per frame, in milliseconds.
+        /// 0 removes the cap. The phase is looked up by path, e.g. "flecs::pipeline::OnUpdate" or "stagehand::OnLateUpdate".
+        void set_phase_time_budget(const godot::String &phase, double budget_milliseconds);
+        /// Returns the time budget of a pipeline phase in milliseconds, or 0 if it has none.
+        [[nodiscard]] double get_phase_time_budget(const godot::String &phase);
+        /// Returns, for every time-sliced system, a Dictionary with the entities it processed in the previous frame, how many passes over its
+        /// entities it has completed, and whether it is in the middle of one.
+        [[nodiscard]] godot::Dictionary get_time_sliced_system_stats();
+        /// Limits a system, looked up by path, to a number of runs per second of simulated time. 0 runs it every frame.
+        void set_system_update_rate(const godot::String &system, double rate);
+        /// Returns the runs per second a system is limited to, or 0 if it runs every frame.
+        [[nodiscard]] double get_system_update_rate(const godot::String &system);
+        /// Spreads the entities of a staggered system (see register_staggered_system()) across a number of runs.
+        void set_system_stagger(const godot::String &system, int slices);
+        /// Returns how many runs a staggered system spreads its entities across, or 0 if the system isn't staggered.
+        [[nodiscard]] int get_system_stagger(const godot::String &system);
+        /// The point simulation LOD tiers are measured from, usually the player or the camera. 2D entities are compared with its x and y.
+        void set_simulation_lod_reference_point(const godot::Vector3 &p_reference_point);
+        [[nodiscard]] godot::Vector3 get_simulation_lod_reference_point() const;
+        /// Distances from the reference point at which simulation LOD tiers 1, 2 and 3 start.
+        void set_simulation_lod_distances(const godot::PackedFloat32Array &p_distances);
+        [[nodiscard]] godot::PackedFloat32Array get_simulation_lod_distances() const;
+        /// Returns the number of coroutine tasks (see stagehand::task) spawned in this world that haven't finished yet.
+        [[nodiscard]] int64_t get_task_count() const;
+        /// Blocks until the simulation step running on the simulation thread (PROGRESS_TICK_ASYNC mode) has finished.
+        /// Every method that reads or writes the world calls this first, so scripts only need it to bound where the wait happens.
+        void wait_for_simulation() const;
+
         /// Sets the world configuration singleton. Format: { "key": value, ... }
         void set_world_configuration(const godot::TypedDictionary<godot::String, godot::Variant> &p_configuration);
         /// Gets the world configuration singleton.
@@ -113,20 +246,117 @@ namespace stagehand {
         bool enter_tree_setup_completed = false;
         bool post_tree_setup_completed = false;
         ProgressTick progress_tick = ProgressTick::PROGRESS_TICK_RENDERING;
+        double fixed_tick_rate = 60.0;
+        int max_substeps = 4;
+        /// Time not yet consumed by a fixed tick.
+        double fixed_time_accumulator = 0.0;
+        double interpolation_alpha = 1.0;
+        /// The pipeline world.progress() runs outside of PROGRESS_TICK_FIXED, PROGRESS_TICK_SPLIT and PROGRESS_TICK_ASYNC modes (the builtin one).
+        flecs::entity default_pipeline;
+        /// Runs the simulation steps in PROGRESS_TICK_ASYNC mode. Declared after `world` so it is joined before the world is destroyed.
+        /// Mutable so that const accessors can wait for the step in flight too.
+        mutable SimulationThread simulation_thread;
+        /// Whether the simulation step of the current frame was started on simulation_thread.
+        bool async_simulation_started = false;
+        int max_parallelism = 0;
+        /// Whether Flecs workers run as WorkerThreadPool tasks (set_task_threads) rather than on threads owned by this world (set_threads).
+        bool use_worker_thread_pool = false;
+        /// WorkerThreadPool threads claimed for this world's Flecs workers (see WorkerThreadPoolTasks::claim()).
+        int worker_thread_pool_workers = 0;
         godot::TypedDictionary<godot::String, godot::Variant> world_configuration;
         godot::TypedArray<godot::String> modules_to_import;
         ScriptLoader script_loader;
 
-        std::unordered_map<godot::StringName, std::function<void(flecs::entity_t, const godot::Variant &)>> component_setters;
-        std::unordered_map<godot::StringName, std::function<godot::Variant(flecs::entity_t)>> component_getters;
-        std::unordered_map<godot::StringName, flecs::entity_t> component_ids;
+        /// The bridge entry points of one component, indexed by component handle.
+        struct ComponentBinding {
+            godot::StringName name;
+            flecs::entity_t id = 0;
+            ComponentGetter getter = nullptr;
+            ComponentSetter setter = nullptr;
+            ComponentBulkSetter bulk_setter = nullptr;
+            ComponentColumnGetter column_getter = nullptr;
+            ComponentBulkValuesCheck bulk_values_check = nullptr;
+        };
+        std::vector<ComponentBinding> component_bindings;
+        std::unordered_map<godot::StringName, int64_t> component_handles;
+        PrefabRegistry prefab_registry;
+        /// Queries built by get_component_column(), by component and prefab (0 for none). Released with the cached prefab entities, since
+        /// they match the prefab entities that were current when they were built.
+        std::map<std::pair<flecs::entity_t, flecs::entity_t>, flecs::query<>> column_queries;
+
+        /// The events of one name buffered while signal batching is enabled. Each data key becomes a column with one value per event.
+        struct SignalBatch {
+            godot::StringName name;
+            int64_t count = 0;
+            godot::PackedInt64Array source_entity_ids;
+            godot::Dictionary columns;
+        };
+        bool signal_batching = false;
+        /// Whether anything is connected to the catch-all signal in use. Refreshed once per progress() (and per emit_event()) so the observer
+        /// doesn't query Godot's connection list for every event.
+        bool has_signal_listeners = true;
+        /// Callables registered with connect_event(), by event name.
+        std::unordered_map<godot::StringName, std::vector<godot::Callable>> event_subscribers;
+
+        /// Forwards typed events (see EVENT()) to the same destinations as EventPayload events.
+        class TypedEventForwarder : public TypedEventSink {
+          public:
+            explicit TypedEventForwarder(FlecsWorld *p_owner) : owner(p_owner) {}
+            [[nodiscard]] bool wants(size_t event_type_index) const override;
+            void deliver(size_t event_type_index, const godot::Dictionary &data, flecs::entity_t source_entity_id) override;
+
+          private:
+            FlecsWorld *owner;
+        };
+        TypedEventForwarder typed_event_forwarder{this};
+        /// Godot-side names of the typed event types, indexed like internal::get_typed_event_types().
+        std::vector<godot::StringName> typed_event_names;
+        /// Buffered batches in the order their first event arrived.
+        std::vector<SignalBatch> signal_batches;
+        std::unordered_map<godot::StringName, size_t> signal_batch_indices;
+
+        /// Queries handed out by create_query(); released before the Flecs world is destroyed.
+        std::unordered_set<FlecsQuery *> live_queries;
+
+        [[nodiscard]] const ComponentBinding *find_component_binding(const godot::StringName &component_name) const;
+        [[nodiscard]] const ComponentBinding *get_component_binding(int64_t component_handle) const;
+        void set_component_with(const ComponentBinding *binding, const godot::Variant &data, uint64_t entity_id);
+        [[nodiscard]] godot::Variant get_component_with(const ComponentBinding *binding, uint64_t entity_id);
+        [[nodiscard]] bool has_component_with(const ComponentBinding *binding, uint64_t entity_id);
+        void add_component_with(const ComponentBinding *binding, uint64_t entity_id);
+        void remove_component_with(const ComponentBinding *binding, uint64_t entity_id);
+        int64_t set_components_bulk_with(const ComponentBinding *binding, const godot::PackedInt64Array &entity_ids, const godot::Variant &values);
+        [[nodiscard]] godot::Dictionary get_component_column_with(const ComponentBinding *binding, const godot::Variant &query_or_prefab);
+        void release_column_queries();
+        uint64_t instantiate_prefab_with(flecs::entity_t prefab_id, const godot::Dictionary &components);
 
         void run_post_tree_setup();
         void populate_scene_children_singleton();
         void setup_entity_renderers_instanced();
         void setup_entity_renderers_multimesh();
         void register_signal_observer();
+        void refresh_signal_listeners();
+        void forward_event(const EventPayload &payload);
+        void dispatch_event(const EventPayload &payload);
+        void buffer_signal(const EventPayload &payload);
+        void flush_batched_signals();
         void import_configured_modules();
+        void apply_progress_tick_pipeline();
+        void progress_fixed(double delta);
+        void progress_simulation(double delta);
+        void progress_presentation(double delta);
+        void run_presentation(double delta, double alpha);
+        void finish_progress();
+        void start_async_simulation();
+        void progress_async_presentation(double delta);
+        /// Runs one PROGRESS_TICK_ASYNC simulation step on the calling thread: the MainThreadSystem systems around world.progress().
+        void progress_async_step(double delta);
+        void update_async_frame_connection();
+        void apply_max_parallelism();
+        /// Looks up a pipeline phase by path, or warns on behalf of `caller` and returns 0.
+        flecs::entity_t lookup_phase(const godot::String &phase, const char *caller);
+        /// Looks up a system by path, or warns on behalf of `caller` and returns 0.
+        flecs::entity_t lookup_system(const godot::String &system, const char *caller);
 
         void cleanup_instanced_renderer_rids();
 
@@ -2,6 +2,7 @@
 
 #include "stagehand/ecs/components/godot_variants.h"
 #include "stagehand/ecs/components/macros.h"
+#include "stagehand/ecs/components/typed_event.h"
 
 namespace stagehand_tests {
 
@@ -61,7 +62,9 @@ namespace stagehand_tests {
     // ─── Counter / accumulator components for system tests ───────────────────────
 
     INT32(TickCount, 0);
+    INT32(RenderFrameCount, 0);
     INT32(AccumulatorValue, 0);
+    INT32(ParallelCounter, 0);
     FLOAT(EntityValue, 0.0f);
 
     // ─── Singleton for passing signal test results back to GDScript ──────────────
@@ -88,6 +91,16 @@ namespace stagehand_tests {
     INT32(TestEventACount, 0);
     INT32(TestEventBCount, 0);
 
+    // ─── Typed event test components ─────────────────────────────────────────────
+
+    EVENT(TestTypedEvent, {
+        godot::Vector2 position;
+        int32_t amount = 0;
+    });
+
+    // Number of TestTypedEvent events seen by a C++ consumer system in the last frame
+    INT32(TypedEventConsumedCount, 0);
+
     // ─── ComponentRegistrar::then() test: default value via on_add ────────────────
 
     FLOAT(DefaultedFloat, 0.0f).then([](flecs::component<DefaultedFloat> c) { c.on_add([](DefaultedFloat &f) { f.value = 42.0f; }); });
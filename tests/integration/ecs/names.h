@@ -34,6 +34,8 @@ namespace stagehand_tests::names {
 
     namespace systems {
         constexpr const char *TICK_COUNTER = NAMESPACE_STR "::Tick Counter";
+        constexpr const char *RENDER_FRAME_COUNTER = NAMESPACE_STR "::Render Frame Counter";
+        constexpr const char *PARALLEL_COUNTER = NAMESPACE_STR "::Parallel Counter";
         constexpr const char *EMIT_TEST_SIGNAL = NAMESPACE_STR "::Emit Test Signal";
         constexpr const char *READ_SCENE_CHILDREN = NAMESPACE_STR "::Read Scene Children";
         constexpr const char *ACCUMULATOR = NAMESPACE_STR "::Accumulator";
@@ -43,6 +45,7 @@ namespace stagehand_tests::names {
         constexpr const char *QUERY_ENTITY_TRANSFORMS = NAMESPACE_STR "::Query Entity Transforms";
         constexpr const char *LOOKUP_ENTITIES = NAMESPACE_STR "::Lookup Entities";
         constexpr const char *QUERY_INSTANCED_RENDERERS = NAMESPACE_STR "::Query Instanced Renderers";
+        constexpr const char *QUERY_MULTIMESH_RENDERERS = NAMESPACE_STR "::Query MultiMesh Renderers";
 
         // Physics test helper systems
         constexpr const char *QUERY_PHYSICS_BODIES = NAMESPACE_STR "::Query Physics Bodies";
@@ -54,6 +57,10 @@ namespace stagehand_tests::names {
         constexpr const char *UNIVERSAL_EVENT_OBSERVER = NAMESPACE_STR "::Universal Event Observer";
         constexpr const char *TEST_EVENT_A_OBSERVER = NAMESPACE_STR "::TestEventA Observer";
         constexpr const char *TEST_EVENT_B_OBSERVER = NAMESPACE_STR "::TestEventB Observer";
+
+        // Typed event test systems
+        constexpr const char *EMIT_TYPED_TEST_EVENTS = NAMESPACE_STR "::Emit Typed Test Events";
+        constexpr const char *CONSUME_TYPED_TEST_EVENTS = NAMESPACE_STR "::Consume Typed Test Events";
     } // namespace systems
 
 #undef NAMESPACE_STR
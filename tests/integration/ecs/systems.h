@@ -8,6 +8,7 @@
 #include "stagehand/ecs/components/rendering.h"
 #include "stagehand/ecs/components/scene_children.h"
 #include "stagehand/ecs/components/transform.h"
+#include "stagehand/ecs/pipeline_phases.h"
 #include "stagehand/entity.h"
 #include "stagehand/utilities/emit_signal.h"
 
@@ -34,6 +35,24 @@ namespace stagehand_tests {
             tick_count.value++;
         });
 
+        // ── Render Frame Counter system ──────────────────────────────────────
+        // Same as Tick Counter, but in OnRender. Used by the fixed tick tests to
+        // tell simulation ticks and presented frames apart.
+        world.set<RenderFrameCount>({0});
+        world.system(names::systems::RENDER_FRAME_COUNTER).kind(stagehand::OnRender).run([](flecs::iter &it) {
+            flecs::world world = it.world();
+            RenderFrameCount &render_frame_count = world.ensure<RenderFrameCount>();
+            render_frame_count.value++;
+        });
+
+        // ── Parallel Counter system ──────────────────────────────────────────
+        // Increments ParallelCounter on every entity that has one, split across
+        // the world's worker threads. Used by the worker thread tests.
+        world.system<ParallelCounter>(names::systems::PARALLEL_COUNTER)
+            .kind(flecs::OnUpdate)
+            .multi_threaded()
+            .each([](ParallelCounter &parallel_counter) { parallel_counter.value++; });
+
         // ── Emit Test Signal (on-demand) ─────────────────────────────────────
         // An on-demand system that emits a GodotSignal when run from GDScript
         // via run_system(). It constructs EventPayload from parameters.
@@ -358,6 +377,41 @@ namespace stagehand_tests {
             });
     });
 
+    // ── Query MultiMesh Renderers (on-demand) ────────────────────────────
+    // Returns the MultiMesh renderers registered by FlecsWorld in a Dictionary
+    // stored in SceneChildrenResult.
+    // Result Dictionary: {
+    //   "renderer_count": N,
+    //   "renderers": [{ "query_count": M, "use_colors": bool, "use_custom_data": bool }, ...]
+    // }
+    REGISTER([](flecs::world &world) {
+        world.system(names::systems::QUERY_MULTIMESH_RENDERERS)
+            .kind(0) // on-demand
+            .run([](flecs::iter &it) {
+                flecs::world world = it.world();
+                const stagehand::rendering::Renderers *renderers = world.try_get<stagehand::rendering::Renderers>();
+
+                godot::Dictionary result;
+                godot::Array renderer_array;
+                if (renderers) {
+                    const auto multimesh_renderers = renderers->renderers_by_type.find(stagehand::rendering::RendererType::MultiMesh);
+                    if (multimesh_renderers != renderers->renderers_by_type.end()) {
+                        for (const auto &[rid, renderer] : multimesh_renderers->second) {
+                            godot::Dictionary renderer_info;
+                            renderer_info["query_count"] = static_cast<int>(renderer.queries.size());
+                            renderer_info["use_colors"] = renderer.use_colors;
+                            renderer_info["use_custom_data"] = renderer.use_custom_data;
+                            renderer_array.push_back(renderer_info);
+                        }
+                    }
+                }
+
+                result["renderer_count"] = static_cast<int>(renderer_array.size());
+                result["renderers"] = renderer_array;
+                world.set<SceneChildrenResult>(SceneChildrenResult(result));
+            });
+    });
+
     // ── Query Physics Bodies (on-demand) ─────────────────────────────────
     // Queries entities with physics body components and returns state info.
     // Parameters: { "prefab": "prefab_name" }
@@ -722,4 +776,30 @@ namespace stagehand_tests {
         });
     });
 
+    REGISTER([](flecs::world &world) {
+        world.set<TypedEventConsumedCount>({0});
+
+        // ── Emit Typed Test Events (on-demand) ───────────────────────────────
+        // Emits `count` TestTypedEvent events, the i-th with amount i and position (i, -i).
+        world.system(names::systems::EMIT_TYPED_TEST_EVENTS)
+            .kind(0) // on-demand
+            .run([](flecs::iter &it) {
+                const godot::Dictionary *parameters = static_cast<const godot::Dictionary *>(it.param());
+                const int32_t count = parameters ? static_cast<int32_t>(parameters->get("count", 1)) : 1;
+                const uint64_t source_entity_id = parameters ? static_cast<uint64_t>(parameters->get("source_entity_id", 0)) : 0;
+                for (int32_t i = 0; i < count; ++i) {
+                    stagehand::emit_event(it.world(), TestTypedEvent{godot::Vector2(i, -i), i}, source_entity_id);
+                }
+            });
+
+        // ── Consume Typed Test Events ────────────────────────────────────────
+        // Counts the TestTypedEvent events queued this frame, without any Godot-side conversion.
+        world.system(names::systems::CONSUME_TYPED_TEST_EVENTS).kind(flecs::PostUpdate).run([](flecs::iter &it) {
+            flecs::world world = it.world();
+            int32_t consumed = 0;
+            stagehand::for_each_event<TestTypedEvent>(world, [&consumed](const TestTypedEvent &, flecs::entity_t) { ++consumed; });
+            world.set<TypedEventConsumedCount>({consumed});
+        });
+    });
+
 } // namespace stagehand_tests
@@ -0,0 +1,206 @@
+extends FlecsWorld
+
+## Tests bulk component operations that act on many entities per call.
+## Covers: set_components_bulk with typed packed arrays, generic Arrays,
+## size mismatches, dead entities and unknown components; get_component_column
+## with and without a prefab filter; instantiate_prefab_batch;
+## set_entities_enabled and destroy_entities.
+
+const ENTITY_COUNT := 64
+
+func _ready() -> void:
+	print("Test: Bulk component operations")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	var entity_ids := PackedInt64Array()
+	for i in ENTITY_COUNT:
+		entity_ids.append(instantiate_prefab("stagehand_tests::TestEntity2D"))
+	progress(0.016)
+
+	# ── Test 1: Numeric component from a PackedFloat32Array ──────────────
+	print("\n=== Test 1: set_components_bulk with PackedFloat32Array ===")
+	var values := PackedFloat32Array()
+	for i in ENTITY_COUNT:
+		values.append(i * 0.5)
+	var written := set_components_bulk("EntityValue", entity_ids, values)
+	assert_eq(written, ENTITY_COUNT, "All entities written")
+	assert_approx(get_component("EntityValue", entity_ids[0]), 0.0, "First entity value")
+	assert_approx(get_component("EntityValue", entity_ids[10]), 5.0, "Middle entity value")
+	assert_approx(get_component("EntityValue", entity_ids[ENTITY_COUNT - 1]), (ENTITY_COUNT - 1) * 0.5, "Last entity value")
+
+	# ── Test 2: Numeric component from other numeric packed arrays ───────
+	print("\n=== Test 2: set_components_bulk with PackedInt32Array ===")
+	var int_values := PackedInt32Array()
+	for i in ENTITY_COUNT:
+		int_values.append(i * 2)
+	written = set_components_bulk("EntityValue", entity_ids, int_values)
+	assert_eq(written, ENTITY_COUNT, "All entities written from integers")
+	assert_approx(get_component("EntityValue", entity_ids[7]), 14.0, "Integer values are converted")
+
+	# ── Test 3: Godot variant component from a PackedVector2Array ────────
+	print("\n=== Test 3: set_components_bulk with PackedVector2Array ===")
+	var positions := PackedVector2Array()
+	for i in ENTITY_COUNT:
+		positions.append(Vector2(i, -i))
+	written = set_components_bulk("Position2D", entity_ids, positions)
+	assert_eq(written, ENTITY_COUNT, "All positions written")
+	var pos: Vector2 = get_component("Position2D", entity_ids[12])
+	assert_true(pos.is_equal_approx(Vector2(12, -12)), "Position2D read back matches bulk value")
+
+	# ── Test 4: Component not yet on the entities is added ───────────────
+	print("\n=== Test 4: set_components_bulk adds missing components ===")
+	var colors := PackedColorArray()
+	for i in ENTITY_COUNT:
+		colors.append(Color(0.0, 0.0, float(i) / ENTITY_COUNT))
+	written = set_components_bulk("TestColor", entity_ids, colors)
+	assert_eq(written, ENTITY_COUNT, "All colors written")
+	assert_true(has_component("TestColor", entity_ids[3]), "Component was added")
+	var color: Color = get_component("TestColor", entity_ids[32])
+	assert_approx(color.b, 0.5, "TestColor read back matches bulk value")
+
+	# ── Test 5: Generic Array input ──────────────────────────────────────
+	print("\n=== Test 5: set_components_bulk with Array ===")
+	var subset := PackedInt64Array([entity_ids[0], entity_ids[1]])
+	written = set_components_bulk("TestString", subset, ["first", "second"])
+	assert_eq(written, 2, "Two strings written")
+	assert_eq(get_component("TestString", entity_ids[1]), "second", "TestString read back matches")
+
+	# ── Test 6: Size mismatch writes nothing ─────────────────────────────
+	print("\n=== Test 6: Size mismatch is rejected ===")
+	written = set_components_bulk("EntityValue", subset, PackedFloat32Array([1.0]))
+	assert_eq(written, 0, "Mismatched sizes write nothing")
+	assert_approx(get_component("EntityValue", entity_ids[0]), 0.0, "Value unchanged after rejected call")
+
+	# ── Test 7: Incompatible packed array is rejected ────────────────────
+	print("\n=== Test 7: Incompatible packed array is rejected ===")
+	written = set_components_bulk("Position2D", subset, PackedFloat32Array([1.0, 2.0]))
+	assert_eq(written, 0, "Float array cannot provide Vector2 values")
+
+	# ── Test 8: Dead entities are skipped ────────────────────────────────
+	print("\n=== Test 8: Dead entities are skipped ===")
+	destroy_entity(entity_ids[1])
+	written = set_components_bulk("EntityValue", subset, PackedFloat32Array([7.0, 8.0]))
+	assert_eq(written, 1, "Only the live entity is written")
+	assert_approx(get_component("EntityValue", entity_ids[0]), 7.0, "Live entity updated")
+
+	# ── Test 9: Unknown component ────────────────────────────────────────
+	print("\n=== Test 9: Unknown component ===")
+	written = set_components_bulk("NoSuchComponent", subset, PackedFloat32Array([1.0, 2.0]))
+	assert_eq(written, 0, "Unknown component writes nothing")
+
+	# ── Test 10: Read a whole column back ────────────────────────────────
+	print("\n=== Test 10: get_component_column for a prefab ===")
+	var column: Dictionary = get_component_column("Position2D", "stagehand_tests::TestEntity2D")
+	var column_ids: PackedInt64Array = column["entity_ids"]
+	assert_eq(typeof(column["values"]), TYPE_PACKED_VECTOR2_ARRAY, "Position2D column is a PackedVector2Array")
+	var column_positions: PackedVector2Array = column["values"]
+	assert_eq(column_ids.size(), ENTITY_COUNT - 1, "Column covers every live instance")
+	assert_eq(column_positions.size(), column_ids.size(), "Column ids and values have the same length")
+	var matched := 0
+	for i in column_ids.size():
+		var index := entity_ids.find(column_ids[i])
+		if index >= 0 and column_positions[i].is_equal_approx(Vector2(index, -index)):
+			matched += 1
+	assert_eq(matched, column_ids.size(), "Every column value belongs to its entity id")
+
+	# ── Test 11: Numeric column without a filter ─────────────────────────
+	print("\n=== Test 11: get_component_column without a filter ===")
+	column = get_component_column("TestColor")
+	assert_eq(typeof(column["values"]), TYPE_PACKED_COLOR_ARRAY, "TestColor column is a PackedColorArray")
+	assert_eq(column["entity_ids"].size(), ENTITY_COUNT - 1, "All entities with TestColor are read")
+	column = get_component_column("EntityValue", "stagehand_tests::TestEntity2D")
+	assert_eq(typeof(column["values"]), TYPE_PACKED_FLOAT32_ARRAY, "EntityValue column is a PackedFloat32Array")
+
+	# ── Test 12: Invalid column requests ─────────────────────────────────
+	print("\n=== Test 12: Invalid column requests ===")
+	assert_true(get_component_column("NoSuchComponent").is_empty(), "Unknown component returns an empty dictionary")
+	assert_true(get_component_column("EntityValue", "NoSuchPrefab").is_empty(), "Unknown prefab returns an empty dictionary")
+
+	# ── Test 13: Batched prefab instantiation ────────────────────────────
+	print("\n=== Test 13: instantiate_prefab_batch ===")
+	var batch_values := PackedFloat32Array()
+	var batch_positions := PackedVector2Array()
+	for i in 100:
+		batch_values.append(1000.0 + i)
+		batch_positions.append(Vector2(i, i * 2))
+	var batch_ids := instantiate_prefab_batch("stagehand_tests::TestEntity2D", 100, {
+		"EntityValue": batch_values,
+		"Position2D": batch_positions,
+	})
+	assert_eq(batch_ids.size(), 100, "Batch returns one id per instance")
+	var all_alive := true
+	for id in batch_ids:
+		all_alive = all_alive and is_alive(id)
+	assert_true(all_alive, "All batch instances are alive")
+	assert_approx(get_component("EntityValue", batch_ids[42]), 1042.0, "Per-instance numeric value applied")
+	var batch_pos: Vector2 = get_component("Position2D", batch_ids[99])
+	assert_true(batch_pos.is_equal_approx(Vector2(99, 198)), "Per-instance Position2D applied")
+	assert_true(has_component("Rotation2D", batch_ids[0]), "Instances inherit prefab components")
+	column = get_component_column("EntityValue", "stagehand_tests::TestEntity2D")
+	assert_eq(column["entity_ids"].size(), ENTITY_COUNT - 1 + 100, "Batch instances are matched as prefab instances")
+
+	# ── Test 14: Batch without component data and invalid batches ────────
+	print("\n=== Test 14: instantiate_prefab_batch edge cases ===")
+	assert_eq(instantiate_prefab_batch("stagehand_tests::TestEntity2D", 5).size(), 5, "Batch without component data")
+	assert_eq(instantiate_prefab_batch("stagehand_tests::TestEntity2D", 0).size(), 0, "Zero count creates nothing")
+	assert_eq(instantiate_prefab_batch("NoSuchPrefab", 5).size(), 0, "Unknown prefab creates nothing")
+	var prefab_count_before: int = get_component_column("EntityValue", "stagehand_tests::TestEntity2D")["entity_ids"].size()
+	assert_eq(instantiate_prefab_batch("stagehand_tests::TestEntity2D", 5, {"EntityValue": PackedFloat32Array([1.0, 2.0])}).size(), 0,
+		"Too few values create nothing")
+	assert_eq(instantiate_prefab_batch("stagehand_tests::TestEntity2D", 2, {"Position2D": PackedFloat32Array([1.0, 2.0])}).size(), 0,
+		"Values of the wrong type create nothing")
+	assert_eq(get_component_column("EntityValue", "stagehand_tests::TestEntity2D")["entity_ids"].size(), prefab_count_before,
+		"Rejected batches leave no instances behind")
+
+	# ── Test 15: Bulk disable and enable ─────────────────────────────────
+	print("\n=== Test 15: set_entities_enabled ===")
+	var updated := set_entities_enabled(batch_ids, false)
+	assert_eq(updated, 100, "All batch instances disabled")
+	assert_true(is_alive(batch_ids[0]), "Disabled instances stay alive")
+	column = get_component_column("EntityValue", "stagehand_tests::TestEntity2D")
+	assert_eq(column["entity_ids"].size(), ENTITY_COUNT - 1 + 5, "Disabled instances are excluded from queries")
+	updated = set_entities_enabled(batch_ids)
+	assert_eq(updated, 100, "All batch instances re-enabled")
+	column = get_component_column("EntityValue", "stagehand_tests::TestEntity2D")
+	assert_eq(column["entity_ids"].size(), ENTITY_COUNT - 1 + 5 + 100, "Re-enabled instances are matched again")
+
+	# ── Test 16: Bulk destruction ────────────────────────────────────────
+	print("\n=== Test 16: destroy_entities ===")
+	var destroyed := destroy_entities(batch_ids)
+	assert_eq(destroyed, 100, "All batch instances destroyed")
+	var any_alive := false
+	for id in batch_ids:
+		any_alive = any_alive or is_alive(id)
+	assert_true(not any_alive, "No batch instance is alive")
+	assert_eq(destroy_entities(batch_ids), 0, "Destroying dead entities is a no-op")
+	assert_eq(set_entities_enabled(batch_ids, false), 0, "Dead entities are not updated")
+	progress(0.016)
+
+	print("\nAll bulk component operation tests passed!")
+	get_tree().quit(0)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func assert_true(value: bool, label: String) -> void:
+	if not value:
+		_fail(label)
+	else:
+		print("  PASS: %s" % label)
+
+func assert_approx(actual: float, expected: float, label: String, epsilon: float = 0.01) -> void:
+	if abs(actual - expected) > epsilon:
+		_fail("%s: expected ~%s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
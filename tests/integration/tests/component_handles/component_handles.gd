@@ -0,0 +1,90 @@
+extends FlecsWorld
+
+## Tests integer component handles and the handle-based component methods.
+## Covers: get_component_handle, set/get/has/add/remove_component_by_handle,
+## set_components_bulk_by_handle, get_component_column_by_handle and
+## invalid handles.
+
+func _ready() -> void:
+	print("Test: Component handles")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	# ── Test 1: Resolve handles ──────────────────────────────────────────
+	print("\n=== Test 1: get_component_handle ===")
+	var value_handle := get_component_handle("EntityValue")
+	var position_handle := get_component_handle("Position2D")
+	assert_true(value_handle >= 0, "EntityValue handle is valid")
+	assert_true(position_handle >= 0, "Position2D handle is valid")
+	assert_true(value_handle != position_handle, "Different components have different handles")
+	assert_eq(get_component_handle("stagehand_tests::EntityValue"), value_handle, "Qualified and short names share a handle")
+	assert_eq(get_component_handle("NoSuchComponent"), -1, "Unknown component returns -1")
+
+	# ── Test 2: Set and get by handle ────────────────────────────────────
+	print("\n=== Test 2: set/get_component_by_handle ===")
+	var entity_id = instantiate_prefab("stagehand_tests::TestEntity2D")
+	set_component_by_handle(value_handle, 12.5, entity_id)
+	assert_approx(get_component_by_handle(value_handle, entity_id), 12.5, "Value written by handle reads back")
+	assert_approx(get_component("EntityValue", entity_id), 12.5, "Value written by handle reads back by name")
+	set_component_by_handle(position_handle, Vector2(3, 4), entity_id)
+	var pos: Vector2 = get_component_by_handle(position_handle, entity_id)
+	assert_true(pos.is_equal_approx(Vector2(3, 4)), "Position2D written by handle reads back")
+
+	# ── Test 3: Singleton by handle ──────────────────────────────────────
+	print("\n=== Test 3: Singleton access by handle ===")
+	var accumulator_handle := get_component_handle("AccumulatorValue")
+	set_component_by_handle(accumulator_handle, 7)
+	assert_eq(get_component_by_handle(accumulator_handle), 7, "Singleton set/get by handle")
+
+	# ── Test 4: has/add/remove by handle ─────────────────────────────────
+	print("\n=== Test 4: has/add/remove_component_by_handle ===")
+	var color_handle := get_component_handle("TestColor")
+	assert_true(not has_component_by_handle(color_handle, entity_id), "Entity starts without TestColor")
+	add_component_by_handle(color_handle, entity_id)
+	assert_true(has_component_by_handle(color_handle, entity_id), "TestColor added by handle")
+	remove_component_by_handle(color_handle, entity_id)
+	assert_true(not has_component_by_handle(color_handle, entity_id), "TestColor removed by handle")
+
+	# ── Test 5: Bulk operations by handle ────────────────────────────────
+	print("\n=== Test 5: Bulk operations by handle ===")
+	var ids := instantiate_prefab_batch("stagehand_tests::TestEntity2D", 3)
+	var written := set_components_bulk_by_handle(value_handle, ids, PackedFloat32Array([1.0, 2.0, 3.0]))
+	assert_eq(written, 3, "Bulk write by handle")
+	var column := get_component_column_by_handle(value_handle, "stagehand_tests::TestEntity2D")
+	assert_eq(column["entity_ids"].size(), 4, "Column read by handle covers every instance")
+
+	# ── Test 6: Invalid handles ──────────────────────────────────────────
+	print("\n=== Test 6: Invalid handles ===")
+	assert_true(get_component_by_handle(-1, entity_id) == null, "Negative handle returns null")
+	assert_true(get_component_by_handle(1000000, entity_id) == null, "Out of range handle returns null")
+	assert_true(not has_component_by_handle(-1, entity_id), "has_component_by_handle with invalid handle is false")
+	set_component_by_handle(-1, 1.0, entity_id)
+	assert_approx(get_component_by_handle(value_handle, entity_id), 12.5, "Invalid handle write is ignored")
+
+	print("\nAll component handle tests passed!")
+	get_tree().quit(0)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func assert_true(value: bool, label: String) -> void:
+	if not value:
+		_fail(label)
+	else:
+		print("  PASS: %s" % label)
+
+func assert_approx(actual: float, expected: float, label: String, epsilon: float = 0.01) -> void:
+	if abs(actual - expected) > epsilon:
+		_fail("%s: expected ~%s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
@@ -0,0 +1,53 @@
+extends FlecsWorld
+
+## Tests MultiMeshRenderer2D nodes whose prefabs can't be resolved:
+## - A renderer none of whose prefab names exist is not registered
+## - Progressing with entities of other prefabs is stable
+## - A renderer with a known prefab next to it is still registered
+
+func _ready() -> void:
+	print("Test: Entity Rendering MultiMesh Unknown Prefabs")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	# Wait one frame so the native FlecsWorld::_ready() callback registers the renderers.
+	await get_tree().process_frame
+
+	# ── Test 1: Only the renderer with a known prefab is registered ──────────
+	run_system("stagehand_tests::Query MultiMesh Renderers", {})
+	progress(0.016)
+	var render_info = get_component("SceneChildrenResult")
+	assert_eq(render_info["renderer_count"], 1, "Only the renderer with a known prefab is registered")
+	assert_eq(render_info["renderers"][0]["query_count"], 1, "Registered renderer has one query")
+
+	# ── Test 2: Entities of other prefabs render without a catch-all query ───
+	for i in range(5):
+		run_system("stagehand::Prefab Instantiation", {
+			"prefab": "stagehand_tests::RenderedEntity2D",
+			"components": {
+				"Position2D": Vector2(i * 50.0, i * 30.0)
+			}
+		})
+	for i in range(5):
+		progress(0.016)
+
+	run_system("stagehand_tests::Query MultiMesh Renderers", {})
+	progress(0.016)
+	render_info = get_component("SceneChildrenResult")
+	assert_eq(render_info["renderer_count"], 1, "Renderer count is stable after progressing")
+
+	print("All entity rendering MultiMesh unknown prefab tests passed!")
+	get_tree().quit(0)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
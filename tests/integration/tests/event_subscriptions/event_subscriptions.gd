@@ -0,0 +1,87 @@
+extends FlecsWorld
+
+## Tests per-event-name subscriptions.
+## Covers: connect_event, disconnect_event, is_event_connected, routing by
+## name, events from C++ systems and coexistence with stagehand_signal_emitted.
+
+var pings: Array = []
+var pongs: Array = []
+var catch_all: Array = []
+
+func _ready() -> void:
+	print("Test: Event subscriptions")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	# ── Test 1: Connect ──────────────────────────────────────────────────
+	print("\n=== Test 1: connect_event ===")
+	connect_event("ping", _on_ping)
+	connect_event("pong", _on_pong)
+	assert_true(is_event_connected("ping", _on_ping), "ping is connected")
+	assert_true(not is_event_connected("ping", _on_pong), "pong handler is not connected to ping")
+
+	# ── Test 2: Routing by name ──────────────────────────────────────────
+	print("\n=== Test 2: Events are routed by name ===")
+	var source := create_entity("PingSource")
+	emit_event("ping", {"value": 1}, source)
+	emit_event("pong", {"value": 2})
+	emit_event("unobserved", {"value": 3})
+	assert_eq(pings.size(), 1, "ping handler called once")
+	assert_eq(pings[0]["data"]["value"], 1, "ping handler receives the payload")
+	assert_eq(pings[0]["source"], source, "ping handler receives the source entity")
+	assert_eq(pongs.size(), 1, "pong handler only receives pong")
+	assert_eq(pongs[0]["source"], 0, "No-source events report 0")
+
+	# ── Test 3: Events from C++ systems ──────────────────────────────────
+	print("\n=== Test 3: Events from C++ systems ===")
+	run_system("stagehand_tests::Emit Test Signal", {"signal_name": "ping", "signal_data": {"value": 4}})
+	progress(0.016)
+	assert_eq(pings.size(), 2, "ping handler called for a system-emitted event")
+	assert_eq(pings[1]["data"]["value"], 4, "System payload reaches the handler")
+
+	# ── Test 4: Coexistence with the catch-all signal ────────────────────
+	print("\n=== Test 4: stagehand_signal_emitted still fires ===")
+	stagehand_signal_emitted.connect(_on_any)
+	emit_event("ping", {"value": 5})
+	assert_eq(pings.size(), 3, "Subscriber called")
+	assert_eq(catch_all, [&"ping"], "Catch-all listener called")
+	stagehand_signal_emitted.disconnect(_on_any)
+
+	# ── Test 5: Disconnect ───────────────────────────────────────────────
+	print("\n=== Test 5: disconnect_event ===")
+	disconnect_event("ping", _on_ping)
+	assert_true(not is_event_connected("ping", _on_ping), "ping is disconnected")
+	emit_event("ping", {"value": 6})
+	assert_eq(pings.size(), 3, "Disconnected handler is not called")
+
+	print("\nAll event subscription tests passed!")
+	get_tree().quit(0)
+
+
+func _on_ping(data: Dictionary, source_entity_id: int) -> void:
+	pings.append({"data": data, "source": source_entity_id})
+
+func _on_pong(data: Dictionary, source_entity_id: int) -> void:
+	pongs.append({"data": data, "source": source_entity_id})
+
+func _on_any(signal_name: StringName, data: Dictionary) -> void:
+	catch_all.append(signal_name)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func assert_true(value: bool, label: String) -> void:
+	if not value:
+		_fail(label)
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
@@ -0,0 +1,94 @@
+extends FlecsWorld
+
+## Tests PROGRESS_TICK_FIXED: the fixed tick accumulator, the substep cap,
+## the interpolation alpha, and that the presentation phases run once per
+## progress() call regardless of how many fixed ticks ran.
+
+func _ready() -> void:
+	print("Test: Fixed tick progress")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	# ── Test 1: Defaults ──────────────────────────────────────────────────
+	print("\n=== Test 1: Defaults ===")
+	assert_approx(fixed_tick_rate, 60.0, "Default tick rate is 60 Hz")
+	assert_eq(max_substeps, 4, "Default substep cap is 4")
+	assert_approx(get_interpolation_alpha(), 1.0, "Alpha is 1 outside of fixed mode")
+
+	fixed_tick_rate = 10.0
+	max_substeps = 3
+	set_progress_tick(PROGRESS_TICK_FIXED)
+	# Progress manually from here on; fixed mode would otherwise also tick in _process().
+	set_process(false)
+
+	# ── Test 2: Frames shorter than a tick only present ───────────────────
+	print("\n=== Test 2: Partial tick ===")
+	_reset_counters()
+	progress(0.05)
+	assert_eq(get_component("TickCount"), 0, "No fixed tick after half a tick")
+	assert_eq(get_component("RenderFrameCount"), 1, "Presentation runs every frame")
+	assert_approx(get_interpolation_alpha(), 0.5, "Alpha is halfway to the next tick")
+
+	# ── Test 3: Accumulated time triggers a tick ──────────────────────────
+	print("\n=== Test 3: Accumulated tick ===")
+	progress(0.06)
+	assert_eq(get_component("TickCount"), 1, "One fixed tick once a full tick has accumulated")
+	assert_eq(get_component("RenderFrameCount"), 2, "Presentation ran once more")
+	assert_approx(get_interpolation_alpha(), 0.1, "Leftover time carries into the alpha")
+
+	# ── Test 4: Substeps are capped ───────────────────────────────────────
+	print("\n=== Test 4: Substep cap ===")
+	_reset_counters()
+	progress(1.0)
+	assert_eq(get_component("TickCount"), 3, "A long frame runs at most max_substeps ticks")
+	assert_eq(get_component("RenderFrameCount"), 1, "Presentation still runs once")
+	assert_true(get_interpolation_alpha() >= 0.0 and get_interpolation_alpha() < 1.0, "Backlog beyond the cap is dropped")
+
+	# ── Test 5: Invalid settings are rejected ─────────────────────────────
+	print("\n=== Test 5: Invalid settings ===")
+	fixed_tick_rate = 0.0
+	max_substeps = 0
+	assert_approx(fixed_tick_rate, 10.0, "A tick rate of 0 is ignored")
+	assert_eq(max_substeps, 3, "A substep cap of 0 is ignored")
+
+	# ── Test 6: Leaving fixed mode ────────────────────────────────────────
+	print("\n=== Test 6: Leaving fixed mode ===")
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+	_reset_counters()
+	progress(0.016)
+	assert_eq(get_component("TickCount"), 1, "Manual progress runs the simulation once")
+	assert_eq(get_component("RenderFrameCount"), 1, "Manual progress runs the presentation once")
+	assert_approx(get_interpolation_alpha(), 1.0, "Alpha is reset to 1")
+
+	print("\nAll fixed tick tests passed!")
+	get_tree().quit(0)
+
+
+func _reset_counters() -> void:
+	set_component("TickCount", 0)
+	set_component("RenderFrameCount", 0)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func assert_true(condition: bool, label: String) -> void:
+	if not condition:
+		_fail(label)
+	else:
+		print("  PASS: %s" % label)
+
+func assert_approx(actual: float, expected: float, label: String, epsilon: float = 0.01) -> void:
+	if absf(actual - expected) > epsilon:
+		_fail("%s: expected ~%s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
@@ -0,0 +1,99 @@
+extends FlecsWorld
+
+## Tests cached queries created from GDScript.
+## Covers: create_query with component lists and query strings, count,
+## entities, column, changed, get_component_column with a FlecsQuery and
+## invalid query terms.
+
+func _ready() -> void:
+	print("Test: FlecsQuery")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	var ids := instantiate_prefab_batch("stagehand_tests::TestEntity2D", 4, {
+		"EntityValue": PackedFloat32Array([1.0, 2.0, 3.0, 4.0]),
+	})
+
+	# ── Test 1: Create from component list ───────────────────────────────
+	print("\n=== Test 1: create_query with component names ===")
+	var query := create_query(PackedStringArray(["EntityValue", "Position2D"]))
+	assert_true(query != null, "Query created")
+	assert_true(query.is_valid(), "Query is valid")
+	assert_eq(query.count(), 4, "Query matches every instance")
+
+	# ── Test 2: Entities and columns ─────────────────────────────────────
+	print("\n=== Test 2: entities and column ===")
+	var matched := query.entities()
+	var values: PackedFloat32Array = query.column("EntityValue")
+	assert_eq(matched.size(), 4, "entities returns every match")
+	assert_eq(values.size(), 4, "column returns one value per entity")
+	var sum := 0.0
+	for i in matched.size():
+		assert_approx(values[i], get_component("EntityValue", matched[i]), "Column value %d matches its entity" % i)
+		sum += values[i]
+	assert_approx(sum, 10.0, "Column covers all written values")
+
+	# ── Test 3: Query string ─────────────────────────────────────────────
+	print("\n=== Test 3: create_query with a query string ===")
+	add_component("TestTag", ids[0])
+	add_component("TestTag", ids[2])
+	var tagged := create_query("stagehand_tests::EntityValue, stagehand_tests::TestTag")
+	assert_true(tagged != null, "Query created from string")
+	assert_eq(tagged.count(), 2, "Query string filters by tag")
+	var tagged_values: PackedFloat32Array = tagged.column("EntityValue")
+	assert_eq(tagged_values.size(), 2, "Column only covers tagged entities")
+
+	# ── Test 4: Cached query follows structural changes ──────────────────
+	print("\n=== Test 4: Cached query tracks new tables ===")
+	remove_component("TestTag", ids[0])
+	assert_eq(tagged.count(), 1, "Removing a tag drops the entity from the query")
+	var extra := instantiate_prefab("stagehand_tests::TestEntity2D")
+	assert_eq(query.count(), 5, "New instance is matched without recreating the query")
+
+	# ── Test 5: Change detection ─────────────────────────────────────────
+	print("\n=== Test 5: changed ===")
+	query.entities()
+	assert_true(not query.changed(), "Query is unchanged after being read")
+	set_component("EntityValue", 42.0, extra)
+	assert_true(query.changed(), "Writing a component marks the query changed")
+
+	# ── Test 6: get_component_column with a query ────────────────────────
+	print("\n=== Test 6: get_component_column with a FlecsQuery ===")
+	var column := get_component_column("EntityValue", tagged)
+	assert_eq(column["entity_ids"].size(), 1, "get_component_column honours the query")
+	assert_eq(column["entity_ids"][0], ids[2], "get_component_column returns the tagged entity")
+
+	# ── Test 7: Invalid usage ────────────────────────────────────────────
+	print("\n=== Test 7: Invalid usage ===")
+	assert_true(create_query(PackedStringArray(["NoSuchComponent"])) == null, "Unknown component returns null")
+	assert_true(create_query(PackedStringArray()) == null, "Empty term list returns null")
+	assert_true(create_query(42) == null, "Non-list, non-string terms return null")
+	assert_true(query.column("TestColor") == null, "Column of a component outside the query returns null")
+
+	print("\nAll FlecsQuery tests passed!")
+	get_tree().quit(0)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func assert_true(value: bool, label: String) -> void:
+	if not value:
+		_fail(label)
+	else:
+		print("  PASS: %s" % label)
+
+func assert_approx(actual: float, expected: float, label: String, epsilon: float = 0.01) -> void:
+	if abs(actual - expected) > epsilon:
+		_fail("%s: expected ~%s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
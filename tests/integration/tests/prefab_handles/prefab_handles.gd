@@ -0,0 +1,71 @@
+extends FlecsWorld
+
+## Tests integer prefab handles.
+## Covers: get_prefab_handle, instantiate_prefab_by_handle with and without
+## component overrides, and invalid handles.
+
+func _ready() -> void:
+	print("Test: Prefab handles")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	# ── Test 1: Resolve handles ──────────────────────────────────────────
+	print("\n=== Test 1: get_prefab_handle ===")
+	var handle := get_prefab_handle("stagehand_tests::TestEntity2D")
+	assert_true(handle >= 0, "TestEntity2D handle is valid")
+	assert_eq(get_prefab_handle("stagehand_tests::TestEntity2D"), handle, "Resolving the same prefab twice returns the same handle")
+	assert_eq(get_prefab_handle("stagehand_tests::NoSuchPrefab"), -1, "Unknown prefab returns -1")
+
+	# ── Test 2: Instantiate by handle ────────────────────────────────────
+	print("\n=== Test 2: instantiate_prefab_by_handle ===")
+	var entity_id := instantiate_prefab_by_handle(handle)
+	assert_true(entity_id != 0, "Instance created by handle")
+	assert_true(is_alive(entity_id), "Instance is alive")
+	assert_true(has_component("EntityValue", entity_id), "Instance inherits the prefab's components")
+
+	# ── Test 3: Component overrides ──────────────────────────────────────
+	print("\n=== Test 3: instantiate_prefab_by_handle with components ===")
+	var configured_id := instantiate_prefab_by_handle(handle, {"EntityValue": 9.5, "Position2D": Vector2(1, 2)})
+	assert_approx(get_component("EntityValue", configured_id), 9.5, "EntityValue override applied")
+	var pos: Vector2 = get_component("Position2D", configured_id)
+	assert_true(pos.is_equal_approx(Vector2(1, 2)), "Position2D override applied")
+
+	# ── Test 4: Name and handle paths agree ──────────────────────────────
+	print("\n=== Test 4: Name and handle instances share a prefab ===")
+	var by_name := instantiate_prefab("stagehand_tests::TestEntity2D")
+	var column := get_component_column("EntityValue", "stagehand_tests::TestEntity2D")
+	assert_eq(column["entity_ids"].size(), 3, "Instances created by name and by handle all inherit from the prefab")
+	assert_true(column["entity_ids"].has(by_name), "Instance created by name is included")
+
+	# ── Test 5: Invalid handles ──────────────────────────────────────────
+	print("\n=== Test 5: Invalid handles ===")
+	assert_eq(instantiate_prefab_by_handle(-1), 0, "Negative handle returns 0")
+	assert_eq(instantiate_prefab_by_handle(1000000), 0, "Out of range handle returns 0")
+
+	print("\nAll prefab handle tests passed!")
+	get_tree().quit(0)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func assert_true(value: bool, label: String) -> void:
+	if not value:
+		_fail(label)
+	else:
+		print("  PASS: %s" % label)
+
+func assert_approx(actual: float, expected: float, label: String, epsilon: float = 0.01) -> void:
+	if abs(actual - expected) > epsilon:
+		_fail("%s: expected ~%s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
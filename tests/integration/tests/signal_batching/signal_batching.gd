@@ -0,0 +1,111 @@
+extends FlecsWorld
+
+## Tests batched signal delivery.
+## Covers: signal_batching, stagehand_signals_emitted, coalescing of same-name
+## events into packed columns, mixed and missing keys, and flushing when
+## batching is turned off.
+
+var batches: Array = []
+var single_signals: Array = []
+
+func _ready() -> void:
+	print("Test: Signal batching")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+	stagehand_signals_emitted.connect(_on_signals_emitted)
+	stagehand_signal_emitted.connect(_on_signal_emitted)
+
+	# ── Test 1: Events are buffered until progress ───────────────────────
+	print("\n=== Test 1: Buffering ===")
+	signal_batching = true
+	assert_true(signal_batching, "signal_batching is enabled")
+	var source := create_entity("BatchSource")
+	emit_event("enemy_died", {"xp": 5, "position": Vector2(1, 2)}, source)
+	emit_event("enemy_died", {"xp": 10, "position": Vector2(3, 4)})
+	emit_event("player_hit", {"damage": 2.5})
+	assert_eq(batches.size(), 0, "Nothing is delivered before progress")
+	assert_eq(single_signals.size(), 0, "Per-event signal is not emitted while batching")
+
+	# ── Test 2: One signal per progress ──────────────────────────────────
+	print("\n=== Test 2: Delivery after progress ===")
+	progress(0.016)
+	assert_eq(batches.size(), 1, "Exactly one batched signal per progress")
+	var names: PackedStringArray = batches[0]["names"]
+	var data: Array = batches[0]["data"]
+	assert_eq(names, PackedStringArray(["enemy_died", "player_hit"]), "Names are distinct, in first-seen order")
+	assert_eq(data.size(), 2, "One data entry per name")
+
+	# ── Test 3: Coalesced columns ────────────────────────────────────────
+	print("\n=== Test 3: Packed columns ===")
+	var died: Dictionary = data[0]
+	assert_eq(died["count"], 2, "Both enemy_died events are counted")
+	assert_eq(died["source_entity_ids"], PackedInt64Array([source, 0]), "Source entity IDs are kept per event")
+	var xp = died["columns"]["xp"]
+	assert_eq(typeof(xp), TYPE_PACKED_INT64_ARRAY, "Integer column is packed")
+	assert_eq(xp, PackedInt64Array([5, 10]), "Integer column values")
+	var positions = died["columns"]["position"]
+	assert_eq(typeof(positions), TYPE_PACKED_VECTOR2_ARRAY, "Vector2 column is packed")
+	assert_eq(positions, PackedVector2Array([Vector2(1, 2), Vector2(3, 4)]), "Vector2 column values")
+	var damage = data[1]["columns"]["damage"]
+	assert_eq(typeof(damage), TYPE_PACKED_FLOAT64_ARRAY, "Float column is packed")
+	assert_approx(damage[0], 2.5, "Float column value")
+
+	# ── Test 4: Mixed and missing keys ───────────────────────────────────
+	print("\n=== Test 4: Mixed and missing keys ===")
+	batches.clear()
+	emit_event("mixed", {"a": 1})
+	emit_event("mixed", {"a": "two", "b": 3})
+	progress(0.016)
+	var mixed: Dictionary = batches[0]["data"][0]["columns"]
+	assert_eq(typeof(mixed["a"]), TYPE_ARRAY, "Mixed-type column stays an Array")
+	assert_eq(mixed["a"], [1, "two"], "Mixed-type column values")
+	assert_eq(mixed["b"], [null, 3], "Key missing from an earlier event is padded with null")
+
+	# ── Test 5: No signal on empty frames ────────────────────────────────
+	print("\n=== Test 5: Empty frames ===")
+	batches.clear()
+	progress(0.016)
+	assert_eq(batches.size(), 0, "No batched signal when no events were raised")
+
+	# ── Test 6: Disabling flushes ────────────────────────────────────────
+	print("\n=== Test 6: Disabling batching ===")
+	emit_event("late", {"value": 1})
+	signal_batching = false
+	assert_eq(batches.size(), 1, "Buffered events are delivered when batching is turned off")
+	emit_event("unbatched", {"value": 2})
+	assert_eq(single_signals.size(), 1, "Per-event signal resumes once batching is off")
+
+	print("\nAll signal batching tests passed!")
+	get_tree().quit(0)
+
+
+func _on_signals_emitted(names: PackedStringArray, data: Array) -> void:
+	batches.append({"names": names, "data": data})
+
+func _on_signal_emitted(signal_name: StringName, data: Dictionary) -> void:
+	single_signals.append(signal_name)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func assert_true(value: bool, label: String) -> void:
+	if not value:
+		_fail(label)
+	else:
+		print("  PASS: %s" % label)
+
+func assert_approx(actual: float, expected: float, label: String, epsilon: float = 0.01) -> void:
+	if abs(actual - expected) > epsilon:
+		_fail("%s: expected ~%s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
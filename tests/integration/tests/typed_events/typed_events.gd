@@ -0,0 +1,86 @@
+extends FlecsWorld
+
+## Tests typed events declared with the EVENT macro.
+## Covers: C++ consumers via for_each_event, delivery to connect_event
+## subscribers and stagehand_signal_emitted, batched delivery, and that
+## buffers are cleared every frame.
+
+const EMIT_SYSTEM := "stagehand_tests::Emit Typed Test Events"
+
+var received: Array = []
+var catch_all: Array = []
+
+func _ready() -> void:
+	print("Test: Typed events")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	# ── Test 1: Subscribers receive typed events as Dictionaries ─────────
+	print("\n=== Test 1: connect_event ===")
+	var source := create_entity("TypedEventSource")
+	connect_event("TestTypedEvent", _on_typed_event)
+	run_system(EMIT_SYSTEM, {"count": 3, "source_entity_id": source})
+	progress(0.016)
+	assert_eq(received.size(), 3, "Subscriber receives every event")
+	assert_eq(received[2]["data"]["amount"], 2, "Integer field is converted")
+	assert_eq(received[2]["data"]["position"], Vector2(2, -2), "Vector2 field is converted")
+	assert_eq(received[0]["source"], source, "Source entity is kept")
+	assert_eq(get_component("TypedEventConsumedCount"), 3, "C++ consumer sees the events in the same frame")
+
+	# ── Test 2: Buffers are cleared every frame ──────────────────────────
+	print("\n=== Test 2: Buffers are cleared ===")
+	progress(0.016)
+	assert_eq(received.size(), 3, "Events are delivered only once")
+	assert_eq(get_component("TypedEventConsumedCount"), 0, "C++ consumer sees no stale events")
+
+	# ── Test 3: Unobserved events still reach C++ consumers ──────────────
+	print("\n=== Test 3: No Godot listeners ===")
+	disconnect_event("TestTypedEvent", _on_typed_event)
+	run_system(EMIT_SYSTEM, {"count": 5})
+	progress(0.016)
+	assert_eq(received.size(), 3, "Disconnected subscriber is not called")
+	assert_eq(get_component("TypedEventConsumedCount"), 5, "C++ consumer still sees unobserved events")
+
+	# ── Test 4: Catch-all signal ─────────────────────────────────────────
+	print("\n=== Test 4: stagehand_signal_emitted ===")
+	stagehand_signal_emitted.connect(_on_any)
+	run_system(EMIT_SYSTEM, {"count": 2})
+	progress(0.016)
+	assert_eq(catch_all, [&"TestTypedEvent", &"TestTypedEvent"], "Catch-all signal is emitted with the struct name")
+	stagehand_signal_emitted.disconnect(_on_any)
+
+	# ── Test 5: Batched delivery ─────────────────────────────────────────
+	print("\n=== Test 5: Batched delivery ===")
+	signal_batching = true
+	var batches: Array = []
+	stagehand_signals_emitted.connect(func(names, data): batches.append({"names": names, "data": data}))
+	run_system(EMIT_SYSTEM, {"count": 4})
+	progress(0.016)
+	assert_eq(batches.size(), 1, "One batched signal")
+	var columns: Dictionary = batches[0]["data"][0]["columns"]
+	assert_eq(batches[0]["names"], PackedStringArray(["TestTypedEvent"]), "Batch is named after the event struct")
+	assert_eq(columns["amount"], PackedInt64Array([0, 1, 2, 3]), "Fields become packed columns")
+	assert_eq(typeof(columns["position"]), TYPE_PACKED_VECTOR2_ARRAY, "Vector2 field becomes a PackedVector2Array")
+
+	print("\nAll typed event tests passed!")
+	get_tree().quit(0)
+
+
+func _on_typed_event(data: Dictionary, source_entity_id: int) -> void:
+	received.append({"data": data, "source": source_entity_id})
+
+func _on_any(signal_name: StringName, _data: Dictionary) -> void:
+	catch_all.append(signal_name)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
@@ -0,0 +1,89 @@
+extends FlecsWorld
+
+## Tests max_parallelism: multi-threaded systems run on the WorkerThreadPool
+## with any number of workers, visit every entity exactly once, and can be
+## resized between frames. Also checks the per-system parallelism stats, and
+## that a max_parallelism larger than the pool is clamped to its free threads.
+
+const ENTITY_COUNT := 1000
+
+var entity_ids: Array[int] = []
+
+func _ready() -> void:
+	print("Test: Worker threads and max_parallelism")
+
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+
+	for i in ENTITY_COUNT:
+		var entity_id := create_entity()
+		set_component("ParallelCounter", 0, entity_id)
+		entity_ids.append(entity_id)
+
+	# ── Test 1: Default parallelism ───────────────────────────────────────
+	print("\n=== Test 1: Default parallelism ===")
+	assert_eq(max_parallelism, 0, "max_parallelism defaults to automatic")
+	progress(0.016)
+	_assert_all_counters(1, "Every entity visited once with the default parallelism")
+
+	# ── Test 2: Single worker ─────────────────────────────────────────────
+	print("\n=== Test 2: Single worker ===")
+	max_parallelism = 1
+	assert_eq(max_parallelism, 1, "max_parallelism set to 1")
+	progress(0.016)
+	_assert_all_counters(2, "Every entity visited once with one worker")
+
+	# ── Test 3: More workers than cores ───────────────────────────────────
+	print("\n=== Test 3: Several workers ===")
+	max_parallelism = 4
+	progress(0.016)
+	progress(0.016)
+	_assert_all_counters(4, "Every entity visited once per frame with four workers")
+
+	# ── Test 4: Negative values are rejected ──────────────────────────────
+	print("\n=== Test 4: Invalid parallelism ===")
+	max_parallelism = -1
+	assert_eq(max_parallelism, 4, "A negative max_parallelism is ignored")
+
+	# ── Test 5: Adaptive system parallelism stats ─────────────────────────
+	print("\n=== Test 5: System parallelism stats ===")
+	var stats := get_system_parallelism_stats()
+	var compose_name := "stagehand::transform::Transform Compose (2D)"
+	assert_eq(stats.has(compose_name), true, "Stats list the transform compose system")
+	var compose_stats: Dictionary = stats.get(compose_name, {})
+	assert_eq(compose_stats.get("multi_threaded"), false, "Transform compose runs single-threaded without changed transforms")
+	assert_eq(compose_stats.get("processed_entities"), 0, "No transforms were composed")
+	assert_eq(compose_stats.get("min_entities", 0) > 0, true, "Transform compose has a minimum workload")
+
+	# ── Test 6: More workers than the pool has ────────────────────────────
+	print("\n=== Test 6: More workers than the WorkerThreadPool ===")
+	max_parallelism = OS.get_processor_count() * 2 + 1
+	progress(0.016)
+	_assert_all_counters(5, "Every entity visited once when clamped to the free pool threads")
+	max_parallelism = 0
+	progress(0.016)
+	_assert_all_counters(6, "Every entity visited once after returning to automatic parallelism")
+
+	print("\nAll worker thread tests passed!")
+	get_tree().quit(0)
+
+
+func _assert_all_counters(expected: int, label: String) -> void:
+	for entity_id in entity_ids:
+		var value = get_component("ParallelCounter", entity_id)
+		if value != expected:
+			_fail("%s: entity %d expected %d, got %s" % [label, entity_id, expected, str(value)])
+			return
+	print("  PASS: %s" % label)
+
+
+# ── Assertion helpers ─────────────────────────────────────────────────────────
+
+func assert_eq(actual, expected, label: String) -> void:
+	if actual != expected:
+		_fail("%s: expected %s, got %s" % [label, str(expected), str(actual)])
+	else:
+		print("  PASS: %s" % label)
+
+func _fail(msg: String) -> void:
+	print("FAIL: %s" % msg)
+	get_tree().quit(1)
@@ -1,7 +1,7 @@
 extends FlecsWorld
 
-## Merged ProgressTick test covering all three modes (MANUAL, RENDERING, PHYSICS)
-## with actual auto-progress assertions using the TickCount system.
+## Merged ProgressTick test covering the MANUAL, RENDERING, PHYSICS, SPLIT and ASYNC modes
+## with actual auto-progress assertions using the TickCount and RenderFrameCount systems.
 
 func _ready() -> void:
 	print("Test: Progress tick modes – manual, rendering and physics auto-progress")
@@ -63,9 +63,66 @@ func _ready() -> void:
 	assert_true(physics_ticks >= 2,
 		"TickCount auto-incremented in PHYSICS mode (%d >= 2)" % physics_ticks)
 
+	# ── Test 5: SPLIT mode — simulation in _physics_process, presentation in _process ──
+	set_progress_tick(PROGRESS_TICK_SPLIT)
+	assert_eq(get_progress_tick(), PROGRESS_TICK_SPLIT, "Mode set to SPLIT")
+
+	# A low physics rate makes the simulation fall behind the displayed frames.
+	var physics_ticks_per_second := Engine.physics_ticks_per_second
+	Engine.physics_ticks_per_second = 1
+	set_component("TickCount", 0)
+	set_component("RenderFrameCount", 0)
+	await get_tree().process_frame
+	await get_tree().process_frame
+	await get_tree().process_frame
+	Engine.physics_ticks_per_second = physics_ticks_per_second
+
+	var split_ticks = get_component("TickCount")
+	var split_frames = get_component("RenderFrameCount")
+	assert_true(split_frames >= 2, "Presentation ran every frame in SPLIT mode (%d >= 2)" % split_frames)
+	assert_true(split_ticks < split_frames,
+		"Simulation ran at the physics rate in SPLIT mode (%d < %d)" % [split_ticks, split_frames])
+	assert_true(get_interpolation_alpha() >= 0.0 and get_interpolation_alpha() <= 1.0, "Alpha follows the physics tick fraction")
+
+	# Manual progress() runs one simulation step and one presentation pass.
+	set_component("TickCount", 0)
+	set_component("RenderFrameCount", 0)
+	progress(0.016)
+	assert_eq(get_component("TickCount"), 1, "progress() ran one simulation step in SPLIT mode")
+	assert_eq(get_component("RenderFrameCount"), 1, "progress() ran one presentation pass in SPLIT mode")
+
+	# Leaving SPLIT mode resets the blend, so renderers draw the current transforms.
+	set_progress_tick(PROGRESS_TICK_MANUAL)
+	assert_eq(get_progress_tick(), PROGRESS_TICK_MANUAL, "Switched back to MANUAL from SPLIT")
+	assert_eq(get_interpolation_alpha(), 1.0, "Alpha is reset to 1 after SPLIT mode")
+
+	# ── Test 6: ASYNC mode — simulation on a thread, presentation in _process ──
+	set_progress_tick(PROGRESS_TICK_ASYNC)
+	assert_eq(get_progress_tick(), PROGRESS_TICK_ASYNC, "Mode set to ASYNC")
+	set_component("TickCount", 0)
+	set_component("RenderFrameCount", 0)
+	await get_tree().process_frame
+	await get_tree().process_frame
+	await get_tree().process_frame
+
+	# The next frame's simulation step may already be running; join it before reading.
+	wait_for_simulation()
+	var async_ticks = get_component("TickCount")
+	var async_frames = get_component("RenderFrameCount")
+	assert_true(async_frames >= 2, "Presentation ran every frame in ASYNC mode (%d >= 2)" % async_frames)
+	assert_true(async_ticks >= async_frames,
+		"Every presented frame was simulated first in ASYNC mode (%d >= %d)" % [async_ticks, async_frames])
+	assert_eq(get_interpolation_alpha(), 1.0, "No interpolation in ASYNC mode")
+
 	# ── Final: switch back to MANUAL and finish ──────────────────────────────
 	set_progress_tick(PROGRESS_TICK_MANUAL)
-	assert_eq(get_progress_tick(), PROGRESS_TICK_MANUAL, "Switched back to MANUAL from PHYSICS")
+	assert_eq(get_progress_tick(), PROGRESS_TICK_MANUAL, "Switched back to MANUAL from ASYNC")
+	assert_eq(get_interpolation_alpha(), 1.0, "Alpha is reset to 1 after ASYNC mode")
+
+	set_component("TickCount", 0)
+	await get_tree().process_frame
+	await get_tree().process_frame
+	assert_eq(get_component("TickCount"), 0, "No simulation step runs after leaving ASYNC mode")
 
 	print("All progress tick mode tests passed!")
 	get_tree().quit(0)
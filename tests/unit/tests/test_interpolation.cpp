@@ -0,0 +1,104 @@
+/// Unit tests for fixed-tick render interpolation.
+/// Tests verify:
+///   1. The InterpolationAlpha singleton defaults to 1 (no interpolation).
+///   2. The snapshot systems start disabled and leave Previous<T> untouched.
+///   3. Once enabled, the snapshot systems copy the transform into Previous<T> before the simulation moves it.
+///   4. interpolate() returns the current transform for unset or unchanged snapshots, and blends otherwise.
+
+#include <flecs.h>
+#include <gtest/gtest.h>
+
+#include <godot_cpp/variant/transform2d.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+
+#include "stagehand/ecs/components/interpolation.h"
+#include "stagehand/ecs/components/transform.h"
+#include "stagehand/ecs/systems/interpolation.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+
+namespace {
+    struct InterpolationFixture : ::testing::Test {
+        flecs::world world;
+
+        void SetUp() override { stagehand::register_components_and_systems_with_world(world); }
+    };
+
+    constexpr float EPSILON = 1e-4f;
+
+    using Previous2D = stagehand::interpolation::Previous<stagehand::transform::Transform2D>;
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Registration
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(InterpolationFixture, AlphaDefaultsToOne) {
+    const auto *alpha = world.try_get<stagehand::interpolation::InterpolationAlpha>();
+    ASSERT_NE(alpha, nullptr);
+    EXPECT_FLOAT_EQ(alpha->value, 1.0f);
+}
+
+TEST_F(InterpolationFixture, SnapshotSystemsStartDisabled) {
+    for (const char *name : stagehand::interpolation::SNAPSHOT_SYSTEM_NAMES) {
+        flecs::entity system = world.lookup(name);
+        ASSERT_TRUE(system.is_valid()) << name;
+        EXPECT_FALSE(system.enabled()) << name;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Snapshots
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(InterpolationFixture, DisabledSnapshotsLeavePreviousUnset) {
+    flecs::entity e = world.entity().set<stagehand::transform::Transform2D>(godot::Transform2D(0.0f, godot::Vector2(3.0f, 4.0f))).add<Previous2D>();
+
+    world.progress(0.016f);
+
+    EXPECT_FALSE(e.get<Previous2D>().is_set);
+}
+
+TEST_F(InterpolationFixture, EnabledSnapshotsCopyTransformBeforeSimulation) {
+    flecs::entity e = world.entity().set<stagehand::transform::Transform2D>(godot::Transform2D(0.0f, godot::Vector2(3.0f, 4.0f))).add<Previous2D>();
+
+    // Moves the entity during the tick, after the snapshot was taken.
+    world.system<stagehand::transform::Transform2D>("test::move").kind(flecs::OnUpdate).each([](stagehand::transform::Transform2D &transform) {
+        transform.set_origin(transform.get_origin() + godot::Vector2(1.0f, 0.0f));
+    });
+
+    stagehand::interpolation::set_snapshots_enabled(world, true);
+    world.progress(0.016f);
+
+    const Previous2D &previous = e.get<Previous2D>();
+    ASSERT_TRUE(previous.is_set);
+    EXPECT_NEAR(previous.value.get_origin().x, 3.0f, EPSILON);
+    EXPECT_NEAR(e.get<stagehand::transform::Transform2D>().get_origin().x, 4.0f, EPSILON);
+
+    stagehand::interpolation::set_snapshots_enabled(world, false);
+    world.progress(0.016f);
+    EXPECT_NEAR(e.get<Previous2D>().value.get_origin().x, 3.0f, EPSILON) << "Disabled snapshots keep the last value";
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// interpolate()
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Interpolate, UnsetSnapshotReturnsCurrent) {
+    const stagehand::interpolation::Previous<godot::Transform2D> previous;
+    const godot::Transform2D current(0.0f, godot::Vector2(10.0f, 0.0f));
+
+    const godot::Transform2D result = stagehand::interpolation::interpolate(previous, current, 0.5f);
+    EXPECT_NEAR(result.get_origin().x, 10.0f, EPSILON);
+}
+
+TEST(Interpolate, BlendsBetweenPreviousAndCurrent) {
+    stagehand::interpolation::Previous<godot::Transform2D> previous;
+    previous.value = godot::Transform2D(0.0f, godot::Vector2(0.0f, 0.0f));
+    previous.is_set = true;
+    const godot::Transform2D current(0.0f, godot::Vector2(10.0f, -4.0f));
+
+    const godot::Transform2D result = stagehand::interpolation::interpolate(previous, current, 0.25f);
+    EXPECT_NEAR(result.get_origin().x, 2.5f, EPSILON);
+    EXPECT_NEAR(result.get_origin().y, -1.0f, EPSILON);
+}
@@ -0,0 +1,486 @@
+/// Unit tests for MultiMesh buffer packing (multimesh_packing.h) and run_parallel_ranges().
+/// Tests verify:
+///   1. 2D and 3D instances are packed in the RenderingServer layout, followed by the color and custom data the renderer uses.
+///   2. Slices are packed at their first instance, and ranges that span several slices are packed completely.
+///   3. Slices with a previous transform are blended by the interpolation alpha.
+///   4. The packing kernel of every format writes the same floats as pack_multimesh_instance(), with and without interpolation.
+///   5. run_parallel_ranges() covers every index exactly once, on several threads when the world has task threads.
+///   6. Packing on several threads gives the same buffer as packing on one.
+///   7. Incremental updates upload nothing without changes, the changed instances while there are few, and everything once the layout changes.
+///   8. Change-detecting queries report only the tables written to since their last iteration.
+///   9. Slices of render transforms are copied into the buffer as is, and pack like the Godot transforms they were converted from. While
+///      interpolating, those with a previous transform component are blended from it like Godot transforms with a previous transform.
+///  10. Culling packs only the instances within the margin of the view, back to back and in order, the same on several threads as on one.
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <flecs.h>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <godot_cpp/variant/basis.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/plane.hpp>
+#include <godot_cpp/variant/rect2.hpp>
+#include <godot_cpp/variant/transform2d.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <godot_cpp/variant/vector4.hpp>
+
+#include "stagehand/utilities/multimesh_packing.h"
+#include "stagehand/utilities/parallel_ranges.h"
+
+namespace {
+    using Slice2D = stagehand::rendering::MultiMeshPackSlice<godot::Transform2D>;
+    using Slice3D = stagehand::rendering::MultiMeshPackSlice<godot::Transform3D>;
+
+    constexpr float EPSILON = 1e-5f;
+
+    struct Static {};
+
+    godot::Transform2D make_transform_2d(float seed) {
+        godot::Transform2D transform;
+        transform.columns[0] = godot::Vector2(seed + 1.0f, seed + 2.0f);
+        transform.columns[1] = godot::Vector2(seed + 3.0f, seed + 4.0f);
+        transform.columns[2] = godot::Vector2(seed + 5.0f, seed + 6.0f);
+        return transform;
+    }
+
+    void expect_floats(const float *actual, const std::vector<float> &expected) {
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_NEAR(actual[i], expected[i], EPSILON) << "Float " << i;
+        }
+    }
+
+    /// Packs the same instances with the kernel of every format and with pack_multimesh_instance(), interpolating every other instance.
+    template <typename TransformType, typename MakeTransform> void expect_kernels_match_reference(MakeTransform make_transform) {
+        constexpr uint32_t COUNT = 7;
+        std::vector<TransformType> transforms;
+        std::vector<stagehand::interpolation::Previous<TransformType>> previous_transforms(COUNT);
+        std::vector<godot::Color> colors;
+        std::vector<stagehand::rendering::CustomData> custom_data;
+        for (uint32_t i = 0; i < COUNT; ++i) {
+            const float seed = static_cast<float>(i);
+            transforms.push_back(make_transform(seed));
+            previous_transforms[i].value = make_transform(seed + 0.5f);
+            previous_transforms[i].is_set = i % 2 == 0;
+            colors.emplace_back(seed, seed + 0.1f, seed + 0.2f, seed + 0.3f);
+            custom_data.emplace_back(godot::Vector4(-seed, seed * 2.0f, seed * 3.0f, seed * 4.0f));
+        }
+
+        for (const bool use_colors : {false, true}) {
+            for (const bool use_custom_data : {false, true}) {
+                for (const bool interpolating : {false, true}) {
+                    stagehand::rendering::MultiMeshPackSlice<TransformType> slice;
+                    slice.transforms = transforms.data();
+                    slice.previous_transforms = interpolating ? previous_transforms.data() : nullptr;
+                    slice.colors = use_colors ? colors.data() : nullptr;
+                    slice.custom_data = use_custom_data ? custom_data.data() : nullptr;
+                    slice.count = COUNT;
+                    const uint32_t floats_per_instance = stagehand::rendering::get_floats_per_instance<TransformType>(use_colors, use_custom_data);
+                    const float alpha = interpolating ? 0.3f : 1.0f;
+
+                    std::vector<float> expected(size_t{COUNT} * floats_per_instance, 0.0f);
+                    for (uint32_t i = 0; i < COUNT; ++i) {
+                        stagehand::rendering::pack_multimesh_instance(slice, i, alpha, expected.data() + size_t{i} * floats_per_instance);
+                    }
+                    std::vector<float> actual(expected.size(), 0.0f);
+                    stagehand::rendering::get_multimesh_pack_kernel<TransformType>(use_colors, use_custom_data)(slice, 0, COUNT, alpha, actual.data());
+
+                    SCOPED_TRACE(testing::Message() << "colors " << use_colors << ", custom data " << use_custom_data << ", interpolating " << interpolating);
+                    expect_floats(actual.data(), expected);
+                }
+            }
+        }
+    }
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Layout
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(MultiMeshPacking, FloatsPerInstance) {
+    EXPECT_EQ(stagehand::rendering::get_floats_per_instance<godot::Transform2D>(false, false), 8u);
+    EXPECT_EQ(stagehand::rendering::get_floats_per_instance<godot::Transform2D>(true, true), 16u);
+    EXPECT_EQ(stagehand::rendering::get_floats_per_instance<godot::Transform3D>(false, false), 12u);
+    EXPECT_EQ(stagehand::rendering::get_floats_per_instance<godot::Transform3D>(true, false), 16u);
+    EXPECT_EQ(stagehand::rendering::get_floats_per_instance<godot::Transform3D>(true, true), 20u);
+}
+
+TEST(MultiMeshPacking, Packs2DInstancesWithColorAndCustomData) {
+    const godot::Transform2D transform = make_transform_2d(0.0f);
+    const godot::Color color(0.1f, 0.2f, 0.3f, 0.4f);
+    const stagehand::rendering::CustomData custom_data(godot::Vector4(5.0f, 6.0f, 7.0f, 8.0f));
+    Slice2D slice;
+    slice.transforms = &transform;
+    slice.colors = &color;
+    slice.custom_data = &custom_data;
+
+    float output[16] = {};
+    stagehand::rendering::pack_multimesh_instance(slice, 0, 1.0f, output);
+
+    expect_floats(output, {1.0f, 3.0f, 0.0f, 5.0f, 2.0f, 4.0f, 0.0f, 6.0f, 0.1f, 0.2f, 0.3f, 0.4f, 5.0f, 6.0f, 7.0f, 8.0f});
+}
+
+TEST(MultiMeshPacking, Packs3DInstancesAsMatrixRows) {
+    godot::Transform3D transform;
+    transform.basis.rows[0] = godot::Vector3(1.0f, 2.0f, 3.0f);
+    transform.basis.rows[1] = godot::Vector3(4.0f, 5.0f, 6.0f);
+    transform.basis.rows[2] = godot::Vector3(7.0f, 8.0f, 9.0f);
+    transform.origin = godot::Vector3(10.0f, 11.0f, 12.0f);
+    Slice3D slice;
+    slice.transforms = &transform;
+
+    float output[12] = {};
+    stagehand::rendering::pack_multimesh_instance(slice, 0, 1.0f, output);
+
+    expect_floats(output, {1.0f, 2.0f, 3.0f, 10.0f, 4.0f, 5.0f, 6.0f, 11.0f, 7.0f, 8.0f, 9.0f, 12.0f});
+}
+
+TEST(MultiMeshPacking, RotatedInstanceMatchesTransformedAxes) {
+    // A quarter turn around Y maps the X axis to -Z. Row-major packing must put that column in floats 0, 4 and 8.
+    const godot::Transform3D transform(godot::Basis(godot::Vector3(0.0f, 1.0f, 0.0f), Math_PI / 2.0f), godot::Vector3());
+    Slice3D slice;
+    slice.transforms = &transform;
+
+    float output[12] = {};
+    stagehand::rendering::pack_multimesh_instance(slice, 0, 1.0f, output);
+
+    const godot::Vector3 x_axis = transform.basis.xform(godot::Vector3(1.0f, 0.0f, 0.0f));
+    EXPECT_NEAR(output[0], x_axis.x, EPSILON);
+    EXPECT_NEAR(output[4], x_axis.y, EPSILON);
+    EXPECT_NEAR(output[8], x_axis.z, EPSILON);
+    EXPECT_NEAR(output[8], -1.0f, EPSILON);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Slices
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(MultiMeshPacking, RangesSpanSlices) {
+    const std::vector<godot::Transform2D> first = {make_transform_2d(0.0f), make_transform_2d(10.0f)};
+    const std::vector<godot::Transform2D> second = {make_transform_2d(20.0f), make_transform_2d(30.0f), make_transform_2d(40.0f)};
+    std::vector<Slice2D> slices(2);
+    slices[0].transforms = first.data();
+    slices[0].count = 2;
+    slices[1].transforms = second.data();
+    slices[1].first_instance = 2;
+    slices[1].count = 3;
+
+    std::vector<float> buffer(5 * 8, -1.0f);
+    const auto kernel = stagehand::rendering::get_multimesh_pack_kernel<godot::Transform2D>(false, false);
+    stagehand::rendering::pack_multimesh_range(slices, 1, 4, kernel, 8, 1.0f, buffer.data());
+
+    EXPECT_FLOAT_EQ(buffer[0 * 8 + 3], -1.0f) << "Instance 0 is outside the range";
+    EXPECT_FLOAT_EQ(buffer[1 * 8 + 3], 15.0f);
+    EXPECT_FLOAT_EQ(buffer[2 * 8 + 3], 25.0f);
+    EXPECT_FLOAT_EQ(buffer[3 * 8 + 3], 35.0f);
+    EXPECT_FLOAT_EQ(buffer[4 * 8 + 3], -1.0f) << "Instance 4 is outside the range";
+}
+
+TEST(MultiMeshPacking, PreviousTransformsAreBlended) {
+    const godot::Transform2D current(0.0f, godot::Vector2(10.0f, 0.0f));
+    stagehand::interpolation::Previous<godot::Transform2D> previous;
+    previous.value = godot::Transform2D(0.0f, godot::Vector2(0.0f, 0.0f));
+    previous.is_set = true;
+    Slice2D slice;
+    slice.transforms = &current;
+    slice.previous_transforms = &previous;
+
+    float output[8] = {};
+    stagehand::rendering::pack_multimesh_instance(slice, 0, 0.25f, output);
+
+    EXPECT_NEAR(output[3], 2.5f, EPSILON);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Kernels
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(MultiMeshPacking, KernelsMatchReference2D) {
+    expect_kernels_match_reference<godot::Transform2D>([](float seed) { return make_transform_2d(seed); });
+}
+
+TEST(MultiMeshPacking, KernelsMatchReference3D) {
+    expect_kernels_match_reference<godot::Transform3D>([](float seed) {
+        godot::Transform3D transform(godot::Basis(godot::Vector3(1.0f, 2.0f, 3.0f).normalized(), seed * 0.1f), godot::Vector3(seed, -seed, seed * 2.0f));
+        transform.basis.scale(godot::Vector3(1.0f, 2.0f, 3.0f));
+        return transform;
+    });
+}
+
+TEST(MultiMeshPacking, RenderTransformsPackLikeTransforms) {
+    constexpr uint32_t COUNT = 5;
+    std::vector<godot::Transform2D> transforms;
+    std::vector<float> render_transforms(size_t{COUNT} * 8);
+    std::vector<godot::Color> colors;
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        transforms.push_back(make_transform_2d(static_cast<float>(i)));
+        stagehand::rendering::pack_render_transform(transforms.back(), render_transforms.data() + size_t{i} * 8);
+        colors.emplace_back(static_cast<float>(i), 0.5f, 0.25f, 1.0f);
+    }
+
+    for (const bool use_colors : {false, true}) {
+        Slice2D converted;
+        converted.transforms = transforms.data();
+        converted.colors = use_colors ? colors.data() : nullptr;
+        converted.count = COUNT;
+        Slice2D copied = converted;
+        copied.transforms = nullptr;
+        copied.render_transforms = render_transforms.data();
+        const uint32_t floats_per_instance = stagehand::rendering::get_floats_per_instance<godot::Transform2D>(use_colors, false);
+        const auto kernel = stagehand::rendering::get_multimesh_pack_kernel<godot::Transform2D>(use_colors, false);
+
+        std::vector<float> expected(size_t{COUNT} * floats_per_instance, 0.0f);
+        std::vector<float> actual(expected.size(), 0.0f);
+        kernel(converted, 0, COUNT, 1.0f, expected.data());
+        kernel(copied, 1, COUNT, 1.0f, actual.data() + floats_per_instance);
+        stagehand::rendering::pack_multimesh_instance(copied, 0, 1.0f, actual.data());
+
+        SCOPED_TRACE(testing::Message() << "colors " << use_colors);
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(MultiMeshPacking, RenderTransformsAreBlendedFromPreviousTransformComponents) {
+    constexpr uint32_t COUNT = 5;
+    constexpr float ALPHA = 0.3f;
+    std::vector<godot::Transform2D> transforms;
+    std::vector<stagehand::interpolation::Previous<godot::Transform2D>> previous_transforms(COUNT);
+    std::vector<stagehand::transform::Transform2D> component_transforms;
+    std::vector<stagehand::interpolation::Previous<stagehand::transform::Transform2D>> previous_component_transforms(COUNT);
+    std::vector<float> render_transforms(size_t{COUNT} * 8);
+    std::vector<godot::Color> colors;
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        const float seed = static_cast<float>(i);
+        transforms.push_back(godot::Transform2D(seed * 0.2f, godot::Vector2(seed * 10.0f, -seed)));
+        component_transforms.push_back(transforms.back());
+        stagehand::rendering::pack_render_transform(transforms.back(), render_transforms.data() + size_t{i} * 8);
+        previous_transforms[i].value = godot::Transform2D(seed * 0.1f, godot::Vector2(seed, seed));
+        previous_transforms[i].is_set = i != 2;
+        previous_component_transforms[i].value = previous_transforms[i].value;
+        previous_component_transforms[i].is_set = previous_transforms[i].is_set;
+        colors.emplace_back(seed, 0.5f, 0.25f, 1.0f);
+    }
+
+    for (const bool use_colors : {false, true}) {
+        Slice2D converted;
+        converted.transforms = transforms.data();
+        converted.previous_transforms = previous_transforms.data();
+        converted.colors = use_colors ? colors.data() : nullptr;
+        converted.count = COUNT;
+        Slice2D blended = converted;
+        blended.transforms = nullptr;
+        blended.previous_transforms = nullptr;
+        blended.render_transforms = render_transforms.data();
+        blended.component_transforms = component_transforms.data();
+        blended.previous_component_transforms = previous_component_transforms.data();
+        const uint32_t floats_per_instance = stagehand::rendering::get_floats_per_instance<godot::Transform2D>(use_colors, false);
+        const auto kernel = stagehand::rendering::get_multimesh_pack_kernel<godot::Transform2D>(use_colors, false);
+
+        std::vector<float> expected(size_t{COUNT} * floats_per_instance, 0.0f);
+        std::vector<float> actual(expected.size(), 0.0f);
+        kernel(converted, 0, COUNT, ALPHA, expected.data());
+        kernel(blended, 1, COUNT, ALPHA, actual.data() + floats_per_instance);
+        stagehand::rendering::pack_multimesh_instance(blended, 0, ALPHA, actual.data());
+
+        SCOPED_TRACE(testing::Message() << "colors " << use_colors);
+        expect_floats(actual.data(), expected);
+        EXPECT_NEAR(actual[3], 0.0f, EPSILON) << "Instance 0 stays at its origin";
+        EXPECT_NEAR(actual[floats_per_instance + 3], 1.0f + (10.0f - 1.0f) * ALPHA, EPSILON) << "Instance 1 is blended";
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Parallel packing
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(ParallelRanges, CoversEveryIndexOnce) {
+    flecs::world world;
+    world.set_task_threads(4);
+    constexpr int32_t COUNT = 10001;
+    std::vector<std::atomic<int32_t>> visits(COUNT);
+    std::mutex threads_mutex;
+    std::set<std::thread::id> threads;
+
+    stagehand::run_parallel_ranges(COUNT, 4, [&](int32_t begin, int32_t end) {
+        for (int32_t i = begin; i < end; ++i) {
+            visits[static_cast<size_t>(i)].fetch_add(1, std::memory_order_relaxed);
+        }
+        const std::lock_guard<std::mutex> lock(threads_mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    for (int32_t i = 0; i < COUNT; ++i) {
+        EXPECT_EQ(visits[static_cast<size_t>(i)].load(), 1) << "Index " << i;
+    }
+    EXPECT_EQ(threads.size(), 4u);
+}
+
+TEST(ParallelRanges, SingleJobRunsInPlace) {
+    const std::thread::id caller = std::this_thread::get_id();
+    int32_t calls = 0;
+    stagehand::run_parallel_ranges(100, 1, [&](int32_t begin, int32_t end) {
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 100);
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(MultiMeshPacking, ParallelPackingMatchesSerial) {
+    flecs::world world;
+    world.set_task_threads(4);
+    constexpr uint32_t TABLE_SIZE = 3000;
+    std::vector<std::vector<godot::Transform2D>> tables(4);
+    std::vector<std::vector<godot::Color>> colors(4);
+    std::vector<Slice2D> slices;
+    uint32_t instance_count = 0;
+    for (size_t table = 0; table < tables.size(); ++table) {
+        // Tables of different sizes, so the ranges don't line up with them.
+        const uint32_t size = TABLE_SIZE + static_cast<uint32_t>(table) * 777;
+        for (uint32_t i = 0; i < size; ++i) {
+            tables[table].push_back(make_transform_2d(static_cast<float>(instance_count + i)));
+            colors[table].push_back(godot::Color(static_cast<float>(i), 0.0f, 0.0f, 1.0f));
+        }
+        Slice2D &slice = slices.emplace_back();
+        slice.transforms = tables[table].data();
+        slice.colors = colors[table].data();
+        slice.first_instance = instance_count;
+        slice.count = size;
+        instance_count += size;
+    }
+    const uint32_t floats_per_instance = stagehand::rendering::get_floats_per_instance<godot::Transform2D>(true, false);
+
+    std::vector<float> serial(size_t{instance_count} * floats_per_instance, 0.0f);
+    std::vector<float> parallel(serial.size(), 0.0f);
+    stagehand::rendering::pack_multimesh_slices(slices, instance_count, true, false, 1.0f, 1, serial.data());
+    stagehand::rendering::pack_multimesh_slices(slices, instance_count, true, false, 1.0f, world.get_stage_count(), parallel.data());
+
+    EXPECT_EQ(serial, parallel);
+    EXPECT_FLOAT_EQ(serial[size_t{instance_count - 1} * floats_per_instance + 3], static_cast<float>(instance_count - 1) + 5.0f);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Incremental updates
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(MultiMeshIncrementalUpdates, ChoosesTheUpload) {
+    using stagehand::rendering::choose_multimesh_upload;
+    using stagehand::rendering::MultiMeshUpload;
+
+    EXPECT_EQ(choose_multimesh_upload(true, 0, 10000), MultiMeshUpload::None);
+    EXPECT_EQ(choose_multimesh_upload(true, 100, 10000), MultiMeshUpload::Instances);
+    EXPECT_EQ(choose_multimesh_upload(true, 5000, 10000), MultiMeshUpload::Full) << "More than an eighth of the instances changed";
+    EXPECT_EQ(choose_multimesh_upload(true, stagehand::rendering::MAX_INCREMENTAL_UPLOAD_INSTANCES + 1, 1000000), MultiMeshUpload::Full);
+    EXPECT_EQ(choose_multimesh_upload(false, 0, 10000), MultiMeshUpload::Full) << "Instances moved in the buffer";
+}
+
+TEST(MultiMeshIncrementalUpdates, QueriesReportChangedTables) {
+    flecs::world world;
+    world.component<godot::Transform2D>();
+    world.component<Static>();
+    const flecs::entity moving = world.entity().set<godot::Transform2D>(make_transform_2d(0.0f));
+    world.entity().set<godot::Transform2D>(make_transform_2d(1.0f)).add<Static>();
+    flecs::query<> query = world.query_builder().with<const godot::Transform2D>().cached().detect_changes().build();
+
+    const auto count_changed_tables = [&query]() {
+        int changed = 0;
+        query.run([&changed](flecs::iter &it) {
+            while (it.next()) {
+                changed += it.changed() ? 1 : 0;
+            }
+        });
+        return changed;
+    };
+
+    EXPECT_EQ(count_changed_tables(), 2) << "Every table is new to the query";
+    EXPECT_EQ(count_changed_tables(), 0);
+
+    moving.set<godot::Transform2D>(make_transform_2d(2.0f));
+    EXPECT_EQ(count_changed_tables(), 1);
+    EXPECT_EQ(count_changed_tables(), 0);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Culling
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(MultiMeshCulling, PacksOnlyVisibleInstances2D) {
+    // Instances along the X axis, one unit apart: a table of Godot transforms, then one of render transforms.
+    std::vector<godot::Transform2D> transforms;
+    std::vector<float> render_transforms(10 * 8);
+    for (int i = 0; i < 10; ++i) {
+        transforms.emplace_back(0.0f, godot::Vector2(static_cast<float>(i), 0.0f));
+        stagehand::rendering::pack_render_transform(godot::Transform2D(0.0f, godot::Vector2(static_cast<float>(10 + i), 0.0f)),
+                                                    render_transforms.data() + static_cast<size_t>(i) * 8);
+    }
+    std::vector<Slice2D> slices(2);
+    slices[0].transforms = transforms.data();
+    slices[0].count = 10;
+    slices[1].render_transforms = render_transforms.data();
+    slices[1].first_instance = 10;
+    slices[1].count = 10;
+
+    stagehand::rendering::MultiMeshCullVolume volume;
+    volume.rect = godot::Rect2(6.0f, -1.0f, 6.0f, 2.0f);
+    volume.margin = 0.5f;
+    std::vector<float> buffer(20 * 8, -1.0f);
+    const uint32_t visible = stagehand::rendering::pack_visible_multimesh_slices(slices, 20, false, false, volume, 1.0f, 1, buffer.data());
+
+    // 5.5 <= x <= 12.5
+    ASSERT_EQ(visible, 7u);
+    for (uint32_t i = 0; i < visible; ++i) {
+        EXPECT_FLOAT_EQ(buffer[size_t{i} * 8 + 3], static_cast<float>(6 + i)) << "Instance " << i;
+    }
+    EXPECT_FLOAT_EQ(buffer[size_t{visible} * 8 + 3], -1.0f) << "Nothing is written past the visible instances";
+}
+
+TEST(MultiMeshCulling, ParallelCullingMatchesSerial3D) {
+    flecs::world world;
+    world.set_task_threads(4);
+    constexpr uint32_t TABLE_SIZE = 5000;
+    std::vector<std::vector<godot::Transform3D>> tables(3);
+    std::vector<Slice3D> slices;
+    uint32_t instance_count = 0;
+    for (size_t table = 0; table < tables.size(); ++table) {
+        for (uint32_t i = 0; i < TABLE_SIZE; ++i) {
+            const float x = static_cast<float>((instance_count + i) % 200) - 100.0f;
+            tables[table].emplace_back(godot::Basis(), godot::Vector3(x, static_cast<float>(table), 0.0f));
+        }
+        Slice3D &slice = slices.emplace_back();
+        slice.transforms = tables[table].data();
+        slice.first_instance = instance_count;
+        slice.count = TABLE_SIZE;
+        instance_count += TABLE_SIZE;
+    }
+
+    // A box around the origin: |x| <= 50, |y| <= 1 and |z| <= 10, with the margin.
+    stagehand::rendering::MultiMeshCullVolume volume;
+    volume.planes = {godot::Plane(godot::Vector3(1.0f, 0.0f, 0.0f), 49.0f),  godot::Plane(godot::Vector3(-1.0f, 0.0f, 0.0f), 49.0f),
+                     godot::Plane(godot::Vector3(0.0f, 1.0f, 0.0f), 0.0f),   godot::Plane(godot::Vector3(0.0f, -1.0f, 0.0f), 0.0f),
+                     godot::Plane(godot::Vector3(0.0f, 0.0f, 1.0f), 9.0f),   godot::Plane(godot::Vector3(0.0f, 0.0f, -1.0f), 9.0f)};
+    volume.margin = 1.0f;
+    const uint32_t floats_per_instance = stagehand::rendering::get_floats_per_instance<godot::Transform3D>(false, false);
+
+    std::vector<float> serial(size_t{instance_count} * floats_per_instance, 0.0f);
+    std::vector<float> parallel(serial.size(), 0.0f);
+    const uint32_t serial_visible =
+        stagehand::rendering::pack_visible_multimesh_slices(slices, instance_count, false, false, volume, 1.0f, 1, serial.data());
+    const uint32_t parallel_visible = stagehand::rendering::pack_visible_multimesh_slices(slices, instance_count, false, false, volume, 1.0f,
+                                                                                          world.get_stage_count(), parallel.data());
+
+    // Tables 0 and 1 are within |y| <= 1, and 101 of every 200 instances are within |x| <= 50.
+    EXPECT_EQ(serial_visible, 2 * (TABLE_SIZE / 200) * 101);
+    EXPECT_EQ(parallel_visible, serial_visible);
+    EXPECT_EQ(serial, parallel);
+    for (uint32_t i = 0; i < serial_visible; ++i) {
+        ASSERT_LE(std::abs(serial[size_t{i} * floats_per_instance + 3]), 50.0f) << "Instance " << i;
+    }
+}
@@ -33,6 +33,12 @@ TEST(Names, PhaseNamesArePrefixed) {
     assert_has_prefix(stagehand::names::phases::PRE_RENDER, "stagehand::", "PRE_RENDER");
     assert_has_prefix(stagehand::names::phases::ON_RENDER, "stagehand::", "ON_RENDER");
     assert_has_prefix(stagehand::names::phases::POST_RENDER, "stagehand::", "POST_RENDER");
+    assert_has_prefix(stagehand::names::phases::PRESENTATION_PHASE, "stagehand::", "PRESENTATION_PHASE");
+}
+
+TEST(Names, PipelineNamesArePrefixed) {
+    assert_has_prefix(stagehand::names::pipelines::SIMULATION, "stagehand::", "SIMULATION");
+    assert_has_prefix(stagehand::names::pipelines::PRESENTATION, "stagehand::", "PRESENTATION");
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -43,6 +49,15 @@ TEST(Names, SystemNamesArePrefixed) {
     assert_has_prefix(stagehand::names::systems::ENTITY_RENDERING_COMPUTE, "stagehand::", "ENTITY_RENDERING_COMPUTE");
     assert_has_prefix(stagehand::names::systems::ENTITY_RENDERING_INSTANCED, "stagehand::", "ENTITY_RENDERING_INSTANCED");
     assert_has_prefix(stagehand::names::systems::ENTITY_RENDERING_MULTIMESH, "stagehand::", "ENTITY_RENDERING_MULTIMESH");
+    assert_has_prefix(stagehand::names::systems::EVENT_QUEUES_EMIT_SIGNALS, "stagehand::", "EVENT_QUEUES_EMIT_SIGNALS");
+    assert_has_prefix(stagehand::names::systems::EVENT_QUEUES_PREPARE, "stagehand::", "EVENT_QUEUES_PREPARE");
+    assert_has_prefix(stagehand::names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_2D, "stagehand::", "INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_2D");
+    assert_has_prefix(stagehand::names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_3D, "stagehand::", "INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_3D");
+    assert_has_prefix(stagehand::names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_2D, "stagehand::", "INTERPOLATION_SNAPSHOT_TRANSFORM_2D");
+    assert_has_prefix(stagehand::names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_3D, "stagehand::", "INTERPOLATION_SNAPSHOT_TRANSFORM_3D");
+    assert_has_prefix(stagehand::names::systems::LOD_ASSIGN_TIERS_2D, "stagehand::", "LOD_ASSIGN_TIERS_2D");
+    assert_has_prefix(stagehand::names::systems::LOD_ASSIGN_TIERS_3D, "stagehand::", "LOD_ASSIGN_TIERS_3D");
+    assert_has_prefix(stagehand::names::systems::PARALLELISM_UPDATE, "stagehand::", "PARALLELISM_UPDATE");
     assert_has_prefix(stagehand::names::systems::PHYSICS_BODY_SPACE_ASSIGNMENT_2D, "stagehand::", "PHYSICS_BODY_SPACE_ASSIGNMENT_2D");
     assert_has_prefix(stagehand::names::systems::PHYSICS_BODY_SPACE_ASSIGNMENT_3D, "stagehand::", "PHYSICS_BODY_SPACE_ASSIGNMENT_3D");
     assert_has_prefix(stagehand::names::systems::PHYSICS_FEEDBACK_ANGULAR_VELOCITY_2D, "stagehand::", "PHYSICS_FEEDBACK_ANG_VEL_2D");
@@ -60,6 +75,10 @@ TEST(Names, SystemNamesArePrefixed) {
     assert_has_prefix(stagehand::names::systems::PHYSICS_SYNC_VELOCITY_2D, "stagehand::", "PHYSICS_SYNC_VELOCITY_2D");
     assert_has_prefix(stagehand::names::systems::PHYSICS_SYNC_VELOCITY_3D, "stagehand::", "PHYSICS_SYNC_VELOCITY_3D");
     assert_has_prefix(stagehand::names::systems::TAG_RESET_CHANGE_DETECTION, "stagehand::", "TAG_RESET_CHANGE_DETECTION");
+    assert_has_prefix(stagehand::names::systems::TASKS_RESUME_ON_LATE_UPDATE, "stagehand::", "TASKS_RESUME_ON_LATE_UPDATE");
+    assert_has_prefix(stagehand::names::systems::TASKS_RESUME_ON_LOAD, "stagehand::", "TASKS_RESUME_ON_LOAD");
+    assert_has_prefix(stagehand::names::systems::TASKS_RESUME_ON_STORE, "stagehand::", "TASKS_RESUME_ON_STORE");
+    assert_has_prefix(stagehand::names::systems::TASKS_RESUME_ON_UPDATE, "stagehand::", "TASKS_RESUME_ON_UPDATE");
     assert_has_prefix(stagehand::names::systems::TRANSFORM_COMPOSE_2D, "stagehand::", "TRANSFORM_COMPOSE_2D");
     assert_has_prefix(stagehand::names::systems::TRANSFORM_COMPOSE_3D, "stagehand::", "TRANSFORM_COMPOSE_3D");
     assert_has_prefix(stagehand::names::systems::TRANSFORM_DECOMPOSE_2D, "stagehand::", "TRANSFORM_DECOMPOSE_2D");
@@ -71,6 +90,15 @@ TEST(Names, AllSystemNamesAreUnique) {
         stagehand::names::systems::ENTITY_RENDERING_COMPUTE,
         stagehand::names::systems::ENTITY_RENDERING_INSTANCED,
         stagehand::names::systems::ENTITY_RENDERING_MULTIMESH,
+        stagehand::names::systems::EVENT_QUEUES_EMIT_SIGNALS,
+        stagehand::names::systems::EVENT_QUEUES_PREPARE,
+        stagehand::names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_2D,
+        stagehand::names::systems::INTERPOLATION_SNAPSHOT_GODOT_TRANSFORM_3D,
+        stagehand::names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_2D,
+        stagehand::names::systems::INTERPOLATION_SNAPSHOT_TRANSFORM_3D,
+        stagehand::names::systems::LOD_ASSIGN_TIERS_2D,
+        stagehand::names::systems::LOD_ASSIGN_TIERS_3D,
+        stagehand::names::systems::PARALLELISM_UPDATE,
         stagehand::names::systems::PHYSICS_BODY_SPACE_ASSIGNMENT_2D,
         stagehand::names::systems::PHYSICS_BODY_SPACE_ASSIGNMENT_3D,
         stagehand::names::systems::PHYSICS_FEEDBACK_ANGULAR_VELOCITY_2D,
@@ -88,6 +116,10 @@ TEST(Names, AllSystemNamesAreUnique) {
         stagehand::names::systems::PHYSICS_SYNC_VELOCITY_2D,
         stagehand::names::systems::PHYSICS_SYNC_VELOCITY_3D,
         stagehand::names::systems::TAG_RESET_CHANGE_DETECTION,
+        stagehand::names::systems::TASKS_RESUME_ON_LATE_UPDATE,
+        stagehand::names::systems::TASKS_RESUME_ON_LOAD,
+        stagehand::names::systems::TASKS_RESUME_ON_STORE,
+        stagehand::names::systems::TASKS_RESUME_ON_UPDATE,
         stagehand::names::systems::TRANSFORM_COMPOSE_2D,
         stagehand::names::systems::TRANSFORM_COMPOSE_3D,
         stagehand::names::systems::TRANSFORM_DECOMPOSE_2D,
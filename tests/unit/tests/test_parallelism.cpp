@@ -0,0 +1,162 @@
+/// Unit tests for adaptive per-system parallelism (register_adaptive_system and ParallelismPolicy).
+/// Tests verify:
+///   1. register_adaptive_system creates a multi-threaded and a disabled single-threaded variant, with the policy on the first.
+///   2. A system that processes fewer than half of min_entities switches to its single-threaded variant.
+///   3. A single-threaded system switches back once it processes at least min_entities.
+///   4. Exactly one variant runs every frame, including the frames in which the system switches.
+///   5. A variant disabled from outside stays disabled, and once enabled again the policy keeps the other one disabled.
+///   6. The built-in transform systems are adaptive.
+
+#include <cstdint>
+#include <flecs.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "stagehand/ecs/components/parallelism.h"
+#include "stagehand/ecs/systems/parallelism.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+#include "work_counter.h"
+
+namespace {
+    using stagehand_tests::WorkCounter;
+    using stagehand_tests::create_counted_entities;
+
+    constexpr const char *ADAPTIVE_SYSTEM_NAME = "test::Adaptive Counter";
+    constexpr int32_t MIN_ENTITIES = 10;
+
+    struct ParallelismFixture : ::testing::Test {
+        flecs::world world;
+        flecs::system adaptive_system;
+
+        void SetUp() override {
+            stagehand::register_components_and_systems_with_world(world);
+            world.component<WorkCounter>();
+            world.set_threads(4);
+            adaptive_system = stagehand::register_adaptive_system<WorkCounter>(
+                world, ADAPTIVE_SYSTEM_NAME, MIN_ENTITIES, [](auto &&builder) -> auto & { return builder.kind(flecs::OnUpdate); },
+                [](flecs::iter &it) {
+                    auto counters = it.field<WorkCounter>(0);
+                    for (auto i : it) {
+                        counters[i].value++;
+                    }
+                });
+        }
+
+        [[nodiscard]] flecs::entity single_threaded_system() const { return world.lookup((std::string(ADAPTIVE_SYSTEM_NAME) + " (Single-Threaded)").c_str()); }
+
+        [[nodiscard]] const stagehand::ParallelismPolicy &policy() const { return adaptive_system.get<stagehand::ParallelismPolicy>(); }
+    };
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Registration
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(ParallelismFixture, RegistersBothVariants) {
+    ASSERT_TRUE(adaptive_system.is_valid());
+    ASSERT_TRUE(single_threaded_system().is_valid());
+    EXPECT_TRUE(adaptive_system.enabled());
+    EXPECT_FALSE(single_threaded_system().enabled());
+
+    ASSERT_TRUE(adaptive_system.has<stagehand::ParallelismPolicy>());
+    EXPECT_EQ(policy().min_entities, MIN_ENTITIES);
+    EXPECT_EQ(policy().single_threaded_system, single_threaded_system().id());
+    EXPECT_TRUE(policy().multi_threaded);
+    EXPECT_EQ(policy().switches, 0);
+}
+
+TEST_F(ParallelismFixture, UpdateSystemIsRegistered) { ASSERT_TRUE(world.lookup(stagehand::names::systems::PARALLELISM_UPDATE).is_valid()); }
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Switching
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(ParallelismFixture, SmallWorkloadRunsSingleThreaded) {
+    create_counted_entities(world, 3);
+
+    world.progress(0.016f);
+    world.progress(0.016f);
+
+    EXPECT_FALSE(policy().multi_threaded);
+    EXPECT_EQ(policy().processed_entities, 3);
+    EXPECT_EQ(policy().switches, 1);
+    EXPECT_FALSE(adaptive_system.enabled());
+    EXPECT_TRUE(single_threaded_system().enabled());
+}
+
+TEST_F(ParallelismFixture, LargeWorkloadSwitchesBackToMultiThreaded) {
+    const std::vector<flecs::entity> initial_entities = create_counted_entities(world, 3);
+    world.progress(0.016f);
+    world.progress(0.016f);
+    ASSERT_FALSE(policy().multi_threaded);
+
+    const std::vector<flecs::entity> added_entities = create_counted_entities(world, 20);
+    world.progress(0.016f); // Chooses from the 3 entities of the previous frame, then processes 23
+    EXPECT_FALSE(policy().multi_threaded);
+    world.progress(0.016f); // Chooses from the 23 entities of the previous frame
+
+    EXPECT_TRUE(policy().multi_threaded);
+    EXPECT_EQ(policy().processed_entities, 23);
+    EXPECT_EQ(policy().switches, 2);
+    EXPECT_TRUE(adaptive_system.enabled());
+    EXPECT_FALSE(single_threaded_system().enabled());
+
+    // Every entity was processed once per frame it existed in, so exactly one variant ran in every frame.
+    for (const flecs::entity &entity : initial_entities) {
+        EXPECT_EQ(entity.get<WorkCounter>().value, 4);
+    }
+    for (const flecs::entity &entity : added_entities) {
+        EXPECT_EQ(entity.get<WorkCounter>().value, 2);
+    }
+}
+
+TEST_F(ParallelismFixture, WorkloadBetweenHalfAndMinimumKeepsMode) {
+    create_counted_entities(world, MIN_ENTITIES / 2);
+
+    world.progress(0.016f);
+    world.progress(0.016f);
+
+    EXPECT_TRUE(policy().multi_threaded) << "A multi-threaded system only switches below half of min_entities";
+    EXPECT_EQ(policy().switches, 0);
+}
+
+TEST_F(ParallelismFixture, UserDisabledSystemStaysDisabled) {
+    create_counted_entities(world, 3);
+    world.progress(0.016f);
+    world.progress(0.016f);
+    ASSERT_TRUE(single_threaded_system().enabled());
+
+    single_threaded_system().disable();
+    create_counted_entities(world, 20);
+    world.progress(0.016f);
+    world.progress(0.016f);
+
+    EXPECT_TRUE(policy().user_disabled);
+    EXPECT_FALSE(adaptive_system.enabled()) << "The policy doesn't switch a disabled system back on";
+    EXPECT_FALSE(single_threaded_system().enabled());
+
+    single_threaded_system().enable();
+    adaptive_system.enable();
+    world.progress(0.016f);
+
+    EXPECT_FALSE(policy().user_disabled);
+    EXPECT_FALSE(policy().multi_threaded);
+    EXPECT_TRUE(single_threaded_system().enabled());
+    EXPECT_FALSE(adaptive_system.enabled()) << "Only one variant runs after the system is enabled again";
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Built-in systems
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(ParallelismFixture, TransformSystemsAreAdaptive) {
+    for (const char *name : {stagehand::names::systems::TRANSFORM_COMPOSE_2D, stagehand::names::systems::TRANSFORM_COMPOSE_3D,
+                             stagehand::names::systems::TRANSFORM_DECOMPOSE_2D, stagehand::names::systems::TRANSFORM_DECOMPOSE_3D}) {
+        flecs::entity system = world.lookup(name);
+        ASSERT_TRUE(system.is_valid()) << name;
+        EXPECT_TRUE(system.has<stagehand::ParallelismPolicy>()) << name;
+        EXPECT_TRUE(world.lookup((std::string(name) + " (Single-Threaded)").c_str()).is_valid()) << name;
+    }
+}
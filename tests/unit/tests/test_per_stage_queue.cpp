@@ -0,0 +1,91 @@
+/// Unit tests for PerStageQueue, the lock-free queue behind emit_signal() and typed events.
+/// Tests verify:
+///   1. prepare() creates a lane for every stage, including stages added by set_threads().
+///   2. lane() returns the lane of the stage a system runs on, and nullptr for stages that weren't prepared.
+///   3. drain() visits items lane by lane, clears the lanes, and keeps items pushed by the callback for the next drain.
+///   4. Multi-threaded systems can push concurrently without losing items.
+
+#include <atomic>
+#include <vector>
+
+#include <flecs.h>
+#include <gtest/gtest.h>
+
+#include "stagehand/utilities/per_stage_queue.h"
+
+namespace {
+    struct PerStageQueueFixture : ::testing::Test {
+        flecs::world world;
+        stagehand::PerStageQueue<int> queue;
+    };
+
+    struct Value {
+        int value = 0;
+    };
+} // namespace
+
+TEST_F(PerStageQueueFixture, PrepareCreatesALanePerStage) {
+    EXPECT_EQ(queue.lane(world), nullptr);
+
+    queue.prepare(world);
+    ASSERT_NE(queue.lane(world), nullptr);
+
+    world.set_threads(3);
+    EXPECT_EQ(queue.lane(world.get_stage(2)), nullptr);
+    queue.prepare(world);
+    EXPECT_NE(queue.lane(world.get_stage(2)), nullptr);
+    EXPECT_NE(queue.lane(world.get_stage(1)), queue.lane(world.get_stage(2)));
+}
+
+TEST_F(PerStageQueueFixture, DrainVisitsAndClearsLanes) {
+    queue.prepare(world);
+    queue.lane(world)->push_back(1);
+    queue.lane(world)->push_back(2);
+
+    std::vector<int> scratch;
+    std::vector<int> drained;
+    queue.drain(scratch, [&](int &item) {
+        drained.push_back(item);
+        if (item == 1) {
+            queue.lane(world)->push_back(3); // Queued while draining: kept for the next drain.
+        }
+    });
+
+    EXPECT_EQ(drained, (std::vector<int>{1, 2}));
+    EXPECT_FALSE(queue.empty());
+
+    drained.clear();
+    queue.drain(scratch, [&](int &item) { drained.push_back(item); });
+    EXPECT_EQ(drained, (std::vector<int>{3}));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(PerStageQueueFixture, MultiThreadedSystemsPushWithoutLosingItems) {
+    constexpr int kEntityCount = 2000;
+    for (int i = 0; i < kEntityCount; ++i) {
+        world.entity().set<Value>({i});
+    }
+    world.set_threads(4);
+    queue.prepare(world);
+
+    std::atomic<int> missing_lanes = 0;
+    world.system<const Value>().multi_threaded().each([&](flecs::iter &it, size_t, const Value &value) {
+        std::vector<int> *lane = queue.lane(it.world());
+        if (lane == nullptr) {
+            ++missing_lanes;
+            return;
+        }
+        lane->push_back(value.value);
+    });
+    world.progress();
+
+    EXPECT_EQ(missing_lanes.load(), 0);
+    long long sum = 0;
+    int count = 0;
+    queue.for_each([&](const int &item) {
+        sum += item;
+        ++count;
+    });
+    EXPECT_EQ(count, kEntityCount);
+    EXPECT_EQ(sum, static_cast<long long>(kEntityCount) * (kEntityCount - 1) / 2);
+}
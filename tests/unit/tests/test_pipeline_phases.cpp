@@ -4,6 +4,11 @@
 ///   2. Phases have the Phase tag.
 ///   3. Phase ordering is correct (dependency chain).
 ///   4. Systems assigned to custom phases execute during world.progress().
+///   5. The simulation pipeline skips the presentation phases (OnRender, PostRender) but still runs PreRender.
+///   6. The presentation pipeline runs only the presentation phases.
+///   7. The asynchronous simulation pipeline skips MainThreadSystem systems.
+///   8. The main thread pipelines run the MainThreadSystem systems before OnUpdate and from OnUpdate on, respectively.
+///   9. An asynchronous step runs the later MainThreadSystem systems after every other simulation system, PreRender included.
 
 #include <flecs.h>
 #include <gtest/gtest.h>
@@ -152,3 +157,134 @@ TEST_F(PipelinePhasesFixture, PostRenderSystemRunsAfterOtherPhases) {
     ASSERT_TRUE(post_render_ran);
     ASSERT_TRUE(post_render_after_pre);
 }
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Simulation / presentation pipelines
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+    struct PhaseCounters {
+        int update = 0;
+        int pre_render = 0;
+        int on_render = 0;
+        int post_render = 0;
+    };
+
+    void add_counting_systems(flecs::world &world, PhaseCounters &counters) {
+        world.system("test::count_update").kind(flecs::OnUpdate).run([&counters](flecs::iter &) { ++counters.update; });
+        world.system("test::count_pre_render").kind(stagehand::PreRender).run([&counters](flecs::iter &) { ++counters.pre_render; });
+        world.system("test::count_on_render").kind(stagehand::OnRender).run([&counters](flecs::iter &) { ++counters.on_render; });
+        world.system("test::count_post_render").kind(stagehand::PostRender).run([&counters](flecs::iter &) { ++counters.post_render; });
+    }
+} // namespace
+
+TEST_F(PipelinePhasesFixture, PipelinesAreLookableByName) {
+    ASSERT_TRUE(world.lookup(stagehand::names::pipelines::SIMULATION).is_valid());
+    ASSERT_TRUE(world.lookup(stagehand::names::pipelines::PRESENTATION).is_valid());
+    ASSERT_TRUE(world.lookup(stagehand::names::pipelines::ASYNC_SIMULATION).is_valid());
+    ASSERT_TRUE(world.lookup(stagehand::names::pipelines::MAIN_THREAD_PRE_UPDATE).is_valid());
+    ASSERT_TRUE(world.lookup(stagehand::names::pipelines::MAIN_THREAD_POST_UPDATE).is_valid());
+    ASSERT_TRUE(stagehand::OnRender.has<stagehand::PresentationPhase>());
+    ASSERT_TRUE(stagehand::PostRender.has<stagehand::PresentationPhase>());
+    ASSERT_FALSE(stagehand::PreRender.has<stagehand::PresentationPhase>());
+}
+
+TEST_F(PipelinePhasesFixture, SimulationPipelineSkipsPresentationPhases) {
+    PhaseCounters counters;
+    add_counting_systems(world, counters);
+
+    world.set_pipeline(stagehand::SimulationPipeline);
+    world.progress(0.016f);
+
+    EXPECT_EQ(counters.update, 1);
+    EXPECT_EQ(counters.pre_render, 1) << "PreRender is part of the simulation";
+    EXPECT_EQ(counters.on_render, 0);
+    EXPECT_EQ(counters.post_render, 0);
+}
+
+TEST_F(PipelinePhasesFixture, PresentationPipelineRunsOnlyPresentationPhases) {
+    PhaseCounters counters;
+    add_counting_systems(world, counters);
+
+    world.run_pipeline(stagehand::PresentationPipeline, 0.016f);
+
+    EXPECT_EQ(counters.update, 0);
+    EXPECT_EQ(counters.pre_render, 0);
+    EXPECT_EQ(counters.on_render, 1);
+    EXPECT_EQ(counters.post_render, 1);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Main thread systems in PROGRESS_TICK_ASYNC mode
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+    struct MainThreadCounters {
+        int early_update = 0;
+        int late_update = 0;
+        int simulation = 0;
+    };
+
+    void add_main_thread_systems(flecs::world &world, MainThreadCounters &counters) {
+        world.system("test::main_thread_early_update")
+            .kind(stagehand::OnEarlyUpdate)
+            .run([&counters](flecs::iter &) { ++counters.early_update; })
+            .add<stagehand::MainThreadSystem>();
+        world.system("test::main_thread_late_update")
+            .kind(stagehand::OnLateUpdate)
+            .run([&counters](flecs::iter &) { ++counters.late_update; })
+            .add<stagehand::MainThreadSystem>();
+        world.system("test::simulation").kind(flecs::OnUpdate).run([&counters](flecs::iter &) { ++counters.simulation; });
+    }
+} // namespace
+
+TEST_F(PipelinePhasesFixture, AsyncSimulationPipelineSkipsMainThreadSystems) {
+    MainThreadCounters counters;
+    add_main_thread_systems(world, counters);
+
+    world.set_pipeline(stagehand::AsyncSimulationPipeline);
+    world.progress(0.016f);
+
+    EXPECT_EQ(counters.early_update, 0);
+    EXPECT_EQ(counters.late_update, 0);
+    EXPECT_EQ(counters.simulation, 1);
+}
+
+TEST_F(PipelinePhasesFixture, MainThreadPipelinesSplitOnUpdatePhase) {
+    MainThreadCounters counters;
+    add_main_thread_systems(world, counters);
+
+    world.run_pipeline(stagehand::MainThreadPreUpdatePipeline, 0.016f);
+    EXPECT_EQ(counters.early_update, 1);
+    EXPECT_EQ(counters.late_update, 0);
+    EXPECT_EQ(counters.simulation, 0);
+
+    world.run_pipeline(stagehand::MainThreadPostUpdatePipeline, 0.016f);
+    EXPECT_EQ(counters.early_update, 1);
+    EXPECT_EQ(counters.late_update, 1);
+    EXPECT_EQ(counters.simulation, 0);
+}
+
+TEST_F(PipelinePhasesFixture, AsyncStepRunsLaterMainThreadSystemsAfterTheSimulation) {
+    auto order = std::make_shared<std::vector<std::string>>();
+
+    world.system("test::early_update").kind(stagehand::OnEarlyUpdate).run([order](flecs::iter &) { order->push_back("OnEarlyUpdate"); });
+    world.system("test::main_thread_early_update")
+        .kind(stagehand::OnEarlyUpdate)
+        .run([order](flecs::iter &) { order->push_back("MainThread OnEarlyUpdate"); })
+        .add<stagehand::MainThreadSystem>();
+    world.system("test::main_thread_late_update")
+        .kind(stagehand::OnLateUpdate)
+        .run([order](flecs::iter &) { order->push_back("MainThread OnLateUpdate"); })
+        .add<stagehand::MainThreadSystem>();
+    world.system("test::pre_render").kind(stagehand::PreRender).run([order](flecs::iter &) { order->push_back("PreRender"); });
+
+    // Same sequence as FlecsWorld::progress_async_step().
+    world.set_pipeline(stagehand::AsyncSimulationPipeline);
+    world.run_pipeline(stagehand::MainThreadPreUpdatePipeline, 0.016f);
+    world.progress(0.016f);
+    world.run_pipeline(stagehand::MainThreadPostUpdatePipeline, 0.016f);
+
+    const std::vector<std::string> expected = {"MainThread OnEarlyUpdate", "OnEarlyUpdate", "PreRender", "MainThread OnLateUpdate"};
+    EXPECT_EQ(*order, expected) << "OnLateUpdate main thread systems move behind PreRender";
+}
@@ -0,0 +1,158 @@
+/// Unit tests for simulation LOD (SimulationLod, the tier assignment systems and register_lod_system).
+/// Tests verify:
+///   1. tier_for_distance_squared() puts each tier boundary in the farther tier.
+///   2. is_update_frame() updates an entity exactly once per interval, and unassigned entities every frame.
+///   3. The assignment systems set the tier of new entities right away, and enable only the tag of that tier.
+///   4. Entities that move are reassigned within reassignment_slices frames, and their tags follow.
+///   5. LOD systems update each tier at its own interval, with the delta time scaled to match.
+
+#include <cstdint>
+#include <flecs.h>
+#include <gtest/gtest.h>
+#include <map>
+
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+
+#include "stagehand/ecs/components/simulation_lod.h"
+#include "stagehand/ecs/components/transform.h"
+#include "stagehand/ecs/systems/simulation_lod.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+#include "work_counter.h"
+
+namespace {
+    using stagehand_tests::WorkCounter;
+
+    constexpr float DELTA_TIME = 0.1f;
+    constexpr float EPSILON = 1e-4f;
+
+    struct SimulationLodFixture : ::testing::Test {
+        flecs::world world;
+
+        void SetUp() override {
+            stagehand::register_components_and_systems_with_world(world);
+            world.component<WorkCounter>();
+            world.get_mut<stagehand::lod::SimulationLodSettings>().tier_distances = {10.0f, 20.0f, 40.0f};
+        }
+
+        flecs::entity create_entity_at(float x) {
+            return world.entity().set<stagehand::transform::Position2D>(godot::Vector2(x, 0.0f)).add<stagehand::lod::SimulationLod>().set<WorkCounter>({});
+        }
+
+        [[nodiscard]] static uint8_t tier_of(flecs::entity entity) { return entity.get<stagehand::lod::SimulationLod>().tier; }
+
+        [[nodiscard]] static int enabled_tier_tag_count(flecs::entity entity) {
+            return static_cast<int>(entity.enabled<stagehand::lod::Tier<0>>()) + static_cast<int>(entity.enabled<stagehand::lod::Tier<1>>()) +
+                   static_cast<int>(entity.enabled<stagehand::lod::Tier<2>>()) + static_cast<int>(entity.enabled<stagehand::lod::Tier<3>>());
+        }
+    };
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Helpers
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(SimulationLodHelpers, TierForDistance) {
+    stagehand::lod::SimulationLodSettings settings;
+    settings.tier_distances = {10.0f, 20.0f, 40.0f};
+
+    EXPECT_EQ(stagehand::lod::tier_for_distance_squared(settings, 0.0f), 0);
+    EXPECT_EQ(stagehand::lod::tier_for_distance_squared(settings, 9.9f * 9.9f), 0);
+    EXPECT_EQ(stagehand::lod::tier_for_distance_squared(settings, 10.0f * 10.0f), 1);
+    EXPECT_EQ(stagehand::lod::tier_for_distance_squared(settings, 39.0f * 39.0f), 2);
+    EXPECT_EQ(stagehand::lod::tier_for_distance_squared(settings, 1000.0f * 1000.0f), 3);
+}
+
+TEST(SimulationLodHelpers, UpdateFramesFollowTheInterval) {
+    const stagehand::lod::TierIntervals intervals = {1, 2, 4, 8};
+    for (uint8_t tier = 0; tier < stagehand::lod::TIER_COUNT; ++tier) {
+        int updates = 0;
+        for (int64_t frame = 0; frame < 8; ++frame) {
+            updates += stagehand::lod::is_update_frame(intervals, tier, 1234, frame) ? 1 : 0;
+        }
+        EXPECT_EQ(updates, 8 / intervals[tier]) << "Tier " << static_cast<int>(tier);
+        EXPECT_NEAR(stagehand::lod::scaled_delta_time(intervals, tier, DELTA_TIME), DELTA_TIME * static_cast<float>(intervals[tier]), EPSILON);
+    }
+    EXPECT_TRUE(stagehand::lod::is_update_frame(intervals, stagehand::lod::UNASSIGNED_TIER, 1234, 3));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Tier assignment
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(SimulationLodFixture, AssignmentSystemsAreRegistered) {
+    EXPECT_TRUE(world.lookup(stagehand::names::systems::LOD_ASSIGN_TIERS_2D).is_valid());
+    EXPECT_TRUE(world.lookup(stagehand::names::systems::LOD_ASSIGN_TIERS_3D).is_valid());
+}
+
+TEST_F(SimulationLodFixture, NewEntitiesAreAssignedRightAway) {
+    const flecs::entity near = create_entity_at(5.0f);
+    const flecs::entity middle = create_entity_at(15.0f);
+    const flecs::entity far = create_entity_at(100.0f);
+    EXPECT_EQ(tier_of(near), stagehand::lod::UNASSIGNED_TIER);
+
+    world.progress(DELTA_TIME);
+
+    EXPECT_EQ(tier_of(near), 0);
+    EXPECT_EQ(tier_of(middle), 1);
+    EXPECT_EQ(tier_of(far), 3);
+    EXPECT_TRUE(near.enabled<stagehand::lod::Tier<0>>());
+    EXPECT_TRUE(middle.enabled<stagehand::lod::Tier<1>>());
+    EXPECT_TRUE(far.enabled<stagehand::lod::Tier<3>>());
+    for (const flecs::entity &entity : {near, middle, far}) {
+        EXPECT_EQ(enabled_tier_tag_count(entity), 1);
+    }
+}
+
+TEST_F(SimulationLodFixture, MovedEntitiesAreReassigned) {
+    const flecs::entity entity = create_entity_at(5.0f);
+    world.progress(DELTA_TIME);
+    ASSERT_EQ(tier_of(entity), 0);
+
+    entity.set<stagehand::transform::Position2D>(godot::Vector2(30.0f, 0.0f));
+    const int32_t slices = world.get<stagehand::lod::SimulationLodSettings>().reassignment_slices;
+    for (int32_t frame = 0; frame < slices; ++frame) {
+        world.progress(DELTA_TIME);
+    }
+
+    EXPECT_EQ(tier_of(entity), 2);
+    EXPECT_TRUE(entity.enabled<stagehand::lod::Tier<2>>());
+    EXPECT_EQ(enabled_tier_tag_count(entity), 1);
+}
+
+TEST_F(SimulationLodFixture, ReferencePointMovesTheTiers) {
+    const flecs::entity entity = create_entity_at(100.0f);
+    world.get_mut<stagehand::lod::SimulationLodSettings>().reference_point = godot::Vector3(100.0f, 0.0f, 0.0f);
+
+    world.progress(DELTA_TIME);
+
+    EXPECT_EQ(tier_of(entity), 0);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// LOD systems
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(SimulationLodFixture, LodSystemUpdatesEachTierAtItsInterval) {
+    const stagehand::lod::TierIntervals intervals = {1, 2, 4, 8};
+    stagehand::lod::register_lod_system<WorkCounter>(
+        world, "test::LOD Counter", intervals, [](auto &&builder) -> auto & { return builder.kind(flecs::OnUpdate); },
+        [](flecs::entity, float delta_time, WorkCounter &counter) {
+            counter.value++;
+            counter.total_time += delta_time;
+        });
+    const std::map<int, flecs::entity> entities_by_tier = {{0, create_entity_at(5.0f)}, {1, create_entity_at(15.0f)}, {2, create_entity_at(30.0f)},
+                                                           {3, create_entity_at(100.0f)}};
+
+    // Tiers are assigned in PreUpdate of the first frame, before the LOD system runs in OnUpdate.
+    for (int frame = 0; frame < 8; ++frame) {
+        world.progress(DELTA_TIME);
+    }
+
+    for (const auto &[tier, entity] : entities_by_tier) {
+        const WorkCounter &counter = entity.get<WorkCounter>();
+        EXPECT_EQ(counter.value, 8 / intervals[static_cast<size_t>(tier)]) << "Tier " << tier;
+        EXPECT_NEAR(counter.total_time, 8 * DELTA_TIME, EPSILON) << "Tier " << tier << " is simulated for as long as the others";
+    }
+}
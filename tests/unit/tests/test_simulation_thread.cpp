@@ -0,0 +1,106 @@
+/// Unit tests for stagehand::SimulationThread.
+/// Tests verify:
+///   1. wait() returns immediately when no job was ever started.
+///   2. A started job runs on another thread, and wait() returns only after it has finished.
+///   3. Consecutive jobs run in order, one at a time, on the same thread.
+///   4. A Flecs world can be progressed on the simulation thread and read back on the calling thread after wait().
+///   5. stop() joins the thread, and start() afterwards creates a new one.
+///   6. wait() called from inside the job returns instead of waiting for the job's own end.
+
+#include <atomic>
+#include <chrono>
+#include <flecs.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "stagehand/registry.h"
+#include "stagehand/utilities/simulation_thread.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Job lifecycle
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(SimulationThread, WaitWithoutJobReturnsImmediately) {
+    stagehand::SimulationThread simulation_thread;
+    simulation_thread.wait();
+    EXPECT_FALSE(simulation_thread.is_busy());
+}
+
+TEST(SimulationThread, JobRunsOnAnotherThreadAndWaitJoinsIt) {
+    stagehand::SimulationThread simulation_thread;
+    std::atomic<bool> finished = false;
+    std::thread::id job_thread_id;
+
+    simulation_thread.start([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        job_thread_id = std::this_thread::get_id();
+        finished = true;
+    });
+    simulation_thread.wait();
+
+    EXPECT_TRUE(finished);
+    EXPECT_FALSE(simulation_thread.is_busy());
+    EXPECT_NE(job_thread_id, std::this_thread::get_id());
+}
+
+TEST(SimulationThread, ConsecutiveJobsRunInOrderOnOneThread) {
+    stagehand::SimulationThread simulation_thread;
+    std::vector<int> order;
+    std::vector<std::thread::id> thread_ids;
+
+    for (int i = 0; i < 5; ++i) {
+        // start() waits for the previous job, so the jobs never overlap and `order` needs no lock.
+        simulation_thread.start([&order, &thread_ids, i]() {
+            order.push_back(i);
+            thread_ids.push_back(std::this_thread::get_id());
+        });
+    }
+    simulation_thread.wait();
+
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+    for (const std::thread::id &thread_id : thread_ids) {
+        EXPECT_EQ(thread_id, thread_ids.front());
+    }
+}
+
+TEST(SimulationThread, ProgressesWorldOffTheCallingThread) {
+    flecs::world world;
+    stagehand::register_components_and_systems_with_world(world);
+    int counter = 0;
+    world.system("test::count").run([&counter](flecs::iter &) { ++counter; });
+
+    stagehand::SimulationThread simulation_thread;
+    for (int i = 0; i < 3; ++i) {
+        simulation_thread.start([&world]() { world.progress(0.016f); });
+        simulation_thread.wait();
+    }
+
+    EXPECT_EQ(counter, 3);
+}
+
+TEST(SimulationThread, StopJoinsAndStartRestarts) {
+    stagehand::SimulationThread simulation_thread;
+    int runs = 0;
+
+    simulation_thread.start([&runs]() { ++runs; });
+    simulation_thread.stop();
+    EXPECT_EQ(runs, 1);
+
+    simulation_thread.start([&runs]() { ++runs; });
+    simulation_thread.wait();
+    EXPECT_EQ(runs, 2);
+}
+
+TEST(SimulationThread, WaitFromInsideTheJobReturns) {
+    stagehand::SimulationThread simulation_thread;
+    std::atomic<bool> waited = false;
+
+    simulation_thread.start([&]() {
+        simulation_thread.wait();
+        waited = true;
+    });
+    simulation_thread.wait();
+
+    EXPECT_TRUE(waited);
+}
@@ -0,0 +1,173 @@
+/// Unit tests for coroutine tasks (stagehand::task, TaskScheduler and the Resume Tasks systems).
+/// Tests verify:
+///   1. A spawned task doesn't run before the world progresses, and starts in the phase it was spawned for.
+///   2. next_frame() suspends the task until the next frame.
+///   3. phase() resumes later in the same frame when the pipeline hasn't reached the phase yet, and in the next frame otherwise.
+///   4. parallel_for() runs every iteration, off the main thread when the world has threads, before the task resumes.
+///   5. Finished tasks are destroyed, and suspended ones are destroyed with the world.
+
+#include <atomic>
+#include <cstdint>
+#include <flecs.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "stagehand/ecs/components/task.h"
+#include "stagehand/ecs/pipeline_phases.h"
+#include "stagehand/names.h"
+#include "stagehand/registry.h"
+
+namespace {
+    struct TaskFixture : ::testing::Test {
+        flecs::world world;
+        std::vector<std::string> log;
+
+        void SetUp() override {
+            stagehand::register_components_and_systems_with_world(world);
+            // Registered after the Resume Tasks systems, so they run after the tasks resumed in the same phase.
+            world.system("test::Update").kind(flecs::OnUpdate).run([this](flecs::iter &) { log.push_back("update"); });
+            world.system("test::Late Update").kind(stagehand::OnLateUpdate).run([this](flecs::iter &) { log.push_back("late update"); });
+        }
+    };
+
+    stagehand::task logging_task(std::vector<std::string> &log) {
+        log.push_back("task start");
+        co_await stagehand::phase(stagehand::OnLateUpdate);
+        log.push_back("task late update");
+        co_await stagehand::phase(flecs::OnUpdate);
+        log.push_back("task next update");
+    }
+
+    stagehand::task frame_counting_task(int &frames) {
+        for (int i = 0; i < 3; ++i) {
+            ++frames;
+            co_await stagehand::next_frame();
+        }
+    }
+
+    /// Sets the flag when destroyed, to tell when the coroutine frame holding it is.
+    struct DestructionFlag {
+        std::shared_ptr<bool> destroyed;
+        ~DestructionFlag() { *destroyed = true; }
+    };
+
+    stagehand::task waiting_task(std::shared_ptr<bool> destroyed) {
+        DestructionFlag flag{std::move(destroyed)};
+        while (true) {
+            co_await stagehand::next_frame();
+        }
+    }
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Registration
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TaskFixture, ResumeSystemsAreRegistered) {
+    for (const char *name : {stagehand::names::systems::TASKS_RESUME_ON_LOAD, stagehand::names::systems::TASKS_RESUME_ON_UPDATE,
+                             stagehand::names::systems::TASKS_RESUME_ON_LATE_UPDATE, stagehand::names::systems::TASKS_RESUME_ON_STORE}) {
+        EXPECT_TRUE(world.lookup(name).is_valid()) << name;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Scheduling
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TaskFixture, SpawnedTaskStartsInItsPhase) {
+    stagehand::spawn_task(world, logging_task(log));
+    EXPECT_TRUE(log.empty()) << "Tasks don't run until the world progresses";
+    EXPECT_EQ(stagehand::get_task_count(world), 1);
+
+    world.progress(0.016f);
+    EXPECT_EQ(log, (std::vector<std::string>{"task start", "update", "task late update", "late update"}));
+
+    log.clear();
+    world.progress(0.016f);
+    EXPECT_EQ(log, (std::vector<std::string>{"task next update", "update", "late update"})) << "An earlier phase resumes next frame";
+    EXPECT_EQ(stagehand::get_task_count(world), 0);
+}
+
+TEST_F(TaskFixture, NextFrameSuspendsUntilNextProgress) {
+    int frames = 0;
+    stagehand::spawn_task(world, frame_counting_task(frames));
+
+    for (int expected = 1; expected <= 3; ++expected) {
+        world.progress(0.016f);
+        EXPECT_EQ(frames, expected);
+    }
+    world.progress(0.016f);
+    EXPECT_EQ(frames, 3);
+    EXPECT_EQ(stagehand::get_task_count(world), 0);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// parallel_for
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TaskFixture, ParallelForRunsEveryIterationBeforeResuming) {
+    world.set_task_threads(4);
+    constexpr int32_t COUNT = 1000;
+    std::vector<int32_t> values(COUNT, 0);
+    std::atomic<int32_t> off_main_thread = 0;
+    const std::thread::id main_thread = std::this_thread::get_id();
+    bool resumed = false;
+
+    auto job = [&]() -> stagehand::task {
+        co_await stagehand::parallel_for(world, COUNT, [&](int32_t i) {
+            values[static_cast<size_t>(i)] = i * 2;
+            if (std::this_thread::get_id() != main_thread) {
+                off_main_thread.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        for (int32_t i = 0; i < COUNT; ++i) {
+            EXPECT_EQ(values[static_cast<size_t>(i)], i * 2);
+        }
+        resumed = true;
+    };
+    stagehand::spawn_task(world, job());
+
+    for (int frame = 0; frame < 100 && !resumed; ++frame) {
+        world.progress(0.016f);
+    }
+
+    EXPECT_TRUE(resumed);
+    EXPECT_EQ(off_main_thread.load(), COUNT);
+    EXPECT_EQ(stagehand::get_task_count(world), 0);
+}
+
+TEST_F(TaskFixture, ParallelForWithoutThreadsRunsInPlace) {
+    bool resumed = false;
+    int32_t sum = 0;
+
+    auto job = [&]() -> stagehand::task {
+        co_await stagehand::parallel_for(world, 10, [&](int32_t i) { sum += i; });
+        resumed = true;
+    };
+    stagehand::spawn_task(world, job());
+    world.progress(0.016f);
+
+    EXPECT_TRUE(resumed) << "Resumes right away";
+    EXPECT_EQ(sum, 45);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Lifetime
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(TaskLifetime, SuspendedTasksAreDestroyedWithTheWorld) {
+    std::shared_ptr<bool> destroyed = std::make_shared<bool>(false);
+    {
+        flecs::world world;
+        stagehand::register_components_and_systems_with_world(world);
+        stagehand::spawn_task(world, waiting_task(destroyed));
+        world.progress(0.016f);
+        world.progress(0.016f);
+        EXPECT_FALSE(*destroyed);
+        EXPECT_EQ(stagehand::get_task_count(world), 1);
+    }
+    EXPECT_TRUE(*destroyed);
+}
@@ -0,0 +1,122 @@
+/// Unit tests for rate-limited and staggered systems (set_system_update_rate, register_staggered_system and Stagger).
+/// Tests verify:
+///   1. set_system_update_rate() limits a system to that many runs per second of simulated time, and 0 restores every-frame runs.
+///   2. A staggered system visits every entity exactly once per cycle of `slices` runs, in equal parts.
+///   3. The delta time passed to a staggered callback covers the whole cycle.
+///   4. set_system_stagger() changes the number of slices of staggered systems only.
+
+#include <cstdint>
+#include <flecs.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stagehand/ecs/components/tick_rate.h"
+#include "stagehand/ecs/systems/staggered.h"
+#include "stagehand/registry.h"
+#include "work_counter.h"
+
+namespace {
+    using stagehand_tests::WorkCounter;
+    using stagehand_tests::create_counted_entities;
+
+    constexpr float DELTA_TIME = 0.1f;
+
+    struct TickRateFixture : ::testing::Test {
+        flecs::world world;
+        int32_t visited_last_run = 0;
+        float last_delta_time = 0.0f;
+
+        void SetUp() override {
+            stagehand::register_components_and_systems_with_world(world);
+            world.component<WorkCounter>();
+        }
+
+        flecs::system register_staggered_counter(int32_t slices) {
+            return stagehand::register_staggered_system<WorkCounter>(
+                world, "test::Staggered Counter", slices, [](auto &&builder) -> auto & { return builder.kind(flecs::OnUpdate); },
+                [this](flecs::entity, float delta_time, WorkCounter &counter) {
+                    counter.value++;
+                    visited_last_run++;
+                    last_delta_time = delta_time;
+                });
+        }
+
+        void progress() {
+            visited_last_run = 0;
+            world.progress(DELTA_TIME);
+        }
+    };
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Update rate
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TickRateFixture, UpdateRateLimitsRuns) {
+    int runs = 0;
+    flecs::system system = world.system("test::Counter").kind(flecs::OnUpdate).run([&runs](flecs::iter &) { ++runs; });
+    EXPECT_DOUBLE_EQ(stagehand::get_system_update_rate(world, system), 0.0);
+
+    stagehand::set_system_update_rate(world, system, 5.0);
+    EXPECT_NEAR(stagehand::get_system_update_rate(world, system), 5.0, 1e-3);
+
+    for (int frame = 0; frame < 10; ++frame) {
+        progress();
+    }
+    EXPECT_NEAR(runs, 5, 1) << "One simulated second at 5 Hz";
+
+    stagehand::set_system_update_rate(world, system, 0.0);
+    runs = 0;
+    for (int frame = 0; frame < 10; ++frame) {
+        progress();
+    }
+    EXPECT_EQ(runs, 10);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Stagger
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TickRateFixture, StaggeredSystemVisitsEveryEntityOncePerCycle) {
+    flecs::system system = register_staggered_counter(4);
+    std::vector<flecs::entity> entities = create_counted_entities(world, 10);
+    EXPECT_EQ(stagehand::get_system_stagger(world, system), 4);
+
+    for (int run = 0; run < 4; ++run) {
+        progress();
+        EXPECT_GE(visited_last_run, 2);
+        EXPECT_LE(visited_last_run, 3);
+    }
+    for (const flecs::entity &entity : entities) {
+        EXPECT_EQ(entity.get<WorkCounter>().value, 1);
+    }
+
+    for (int run = 0; run < 4; ++run) {
+        progress();
+    }
+    for (const flecs::entity &entity : entities) {
+        EXPECT_EQ(entity.get<WorkCounter>().value, 2);
+    }
+}
+
+TEST_F(TickRateFixture, StaggeredDeltaTimeCoversTheCycle) {
+    register_staggered_counter(4);
+    create_counted_entities(world, 8);
+
+    progress();
+    EXPECT_NEAR(last_delta_time, DELTA_TIME * 4.0f, 1e-4f);
+}
+
+TEST_F(TickRateFixture, SetStaggerOnlyAffectsStaggeredSystems) {
+    flecs::system system = register_staggered_counter(4);
+    std::vector<flecs::entity> entities = create_counted_entities(world, 10);
+
+    stagehand::set_system_stagger(world, system, 1);
+    progress();
+    EXPECT_EQ(visited_last_run, 10);
+
+    flecs::system regular = world.system("test::Regular").kind(flecs::OnUpdate).run([](flecs::iter &) {});
+    stagehand::set_system_stagger(world, regular, 4);
+    EXPECT_EQ(stagehand::get_system_stagger(world, regular), 0);
+    EXPECT_FALSE(regular.has<stagehand::Stagger>());
+}
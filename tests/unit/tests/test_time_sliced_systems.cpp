@@ -0,0 +1,184 @@
+/// Unit tests for time-sliced systems (register_time_sliced_system, PhaseTimeBudget and TimeSlicedCursor).
+/// Tests verify:
+///   1. set_phase_time_budget() and get_phase_time_budget() round-trip, and a budget of 0 removes PhaseTimeBudget.
+///   2. Without a budget, a time-sliced system processes all of its entities every frame and completes a pass per frame.
+///   3. Out of budget, a system processes one entity per frame and resumes from the cursor, visiting every entity once per pass.
+///   4. The cursor resumes across tables.
+///   5. Systems of the same phase share its budget, and each still processes at least one entity per frame.
+///   6. Once the rows after the cursor are gone, the pass ends and a new one starts in the same frame.
+///   7. A cursor whose table no longer matches restarts from the first table in the same frame.
+
+#include <chrono>
+#include <cstdint>
+#include <flecs.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "stagehand/ecs/components/time_budget.h"
+#include "stagehand/ecs/systems/time_sliced.h"
+#include "stagehand/registry.h"
+#include "work_counter.h"
+
+namespace {
+    using stagehand_tests::WorkCounter;
+    using stagehand_tests::create_counted_entities;
+    using stagehand_tests::total_work;
+
+    struct OtherTable {};
+
+    /// Well above the budgets below, so a budgeted system always runs out of time after its first entity.
+    constexpr auto SLOW_WORK = std::chrono::milliseconds(2);
+    constexpr double SMALL_BUDGET_MILLISECONDS = 0.5;
+
+    struct TimeSlicedFixture : ::testing::Test {
+        flecs::world world;
+
+        void SetUp() override {
+            stagehand::register_components_and_systems_with_world(world);
+            world.component<WorkCounter>();
+            world.component<OtherTable>();
+        }
+
+        flecs::system register_counter(const char *name, bool slow) {
+            return stagehand::register_time_sliced_system<WorkCounter>(
+                world, name, flecs::OnUpdate, [](auto &&builder) -> auto & { return builder; },
+                [slow](flecs::entity, WorkCounter &counter) {
+                    if (slow) {
+                        std::this_thread::sleep_for(SLOW_WORK);
+                    }
+                    counter.value++;
+                });
+        }
+    };
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Phase budgets
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TimeSlicedFixture, PhaseBudgetRoundTrips) {
+    EXPECT_DOUBLE_EQ(stagehand::get_phase_time_budget(world, flecs::OnUpdate), 0.0);
+
+    stagehand::set_phase_time_budget(world, flecs::OnUpdate, 2.5);
+    EXPECT_DOUBLE_EQ(stagehand::get_phase_time_budget(world, flecs::OnUpdate), 2.5);
+    EXPECT_DOUBLE_EQ(stagehand::get_phase_time_budget(world, flecs::PostUpdate), 0.0) << "Budgets are per phase";
+
+    stagehand::set_phase_time_budget(world, flecs::OnUpdate, 0.0);
+    EXPECT_FALSE(world.entity(flecs::OnUpdate).has<stagehand::PhaseTimeBudget>());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Slicing
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TimeSlicedFixture, WithoutBudgetProcessesEverythingEveryFrame) {
+    flecs::system system = register_counter("test::Unbudgeted", false);
+    std::vector<flecs::entity> entities = create_counted_entities(world, 20);
+
+    world.progress(0.016f);
+    world.progress(0.016f);
+
+    for (const flecs::entity &entity : entities) {
+        EXPECT_EQ(entity.get<WorkCounter>().value, 2);
+    }
+    const stagehand::TimeSlicedCursor &cursor = system.get<stagehand::TimeSlicedCursor>();
+    EXPECT_EQ(cursor.completed_passes, 2);
+    EXPECT_EQ(cursor.processed_entities, 20);
+    EXPECT_EQ(cursor.table, nullptr);
+}
+
+TEST_F(TimeSlicedFixture, OutOfBudgetResumesFromCursor) {
+    flecs::system system = register_counter("test::Budgeted", true);
+    std::vector<flecs::entity> entities = create_counted_entities(world, 4);
+    stagehand::set_phase_time_budget(world, flecs::OnUpdate, SMALL_BUDGET_MILLISECONDS);
+
+    for (int frame = 1; frame <= 3; ++frame) {
+        world.progress(0.016f);
+        EXPECT_EQ(total_work(entities), frame);
+        EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().processed_entities, 1);
+        EXPECT_NE(system.get<stagehand::TimeSlicedCursor>().table, nullptr) << "Mid-pass after frame " << frame;
+    }
+
+    world.progress(0.016f);
+    for (const flecs::entity &entity : entities) {
+        EXPECT_EQ(entity.get<WorkCounter>().value, 1) << "Every entity is visited once per pass";
+    }
+    EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().completed_passes, 1);
+    EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().table, nullptr);
+
+    world.progress(0.016f);
+    EXPECT_EQ(total_work(entities), 5) << "The next pass starts from the beginning";
+}
+
+TEST_F(TimeSlicedFixture, CursorResumesAcrossTables) {
+    flecs::system system = register_counter("test::Budgeted", true);
+    std::vector<flecs::entity> entities = create_counted_entities(world, 4);
+    entities[2].add<OtherTable>();
+    entities[3].add<OtherTable>();
+    stagehand::set_phase_time_budget(world, flecs::OnUpdate, SMALL_BUDGET_MILLISECONDS);
+
+    for (int frame = 0; frame < 4; ++frame) {
+        world.progress(0.016f);
+    }
+
+    for (const flecs::entity &entity : entities) {
+        EXPECT_EQ(entity.get<WorkCounter>().value, 1);
+    }
+    EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().completed_passes, 1);
+}
+
+TEST_F(TimeSlicedFixture, SystemsShareThePhaseBudget) {
+    flecs::system first = register_counter("test::First", true);
+    flecs::system second = register_counter("test::Second", true);
+    create_counted_entities(world, 4);
+    stagehand::set_phase_time_budget(world, flecs::OnUpdate, SMALL_BUDGET_MILLISECONDS);
+
+    world.progress(0.016f);
+
+    // The first system used up the budget, but the second one still makes progress.
+    EXPECT_EQ(first.get<stagehand::TimeSlicedCursor>().processed_entities, 1);
+    EXPECT_EQ(second.get<stagehand::TimeSlicedCursor>().processed_entities, 1);
+    const stagehand::PhaseTimeBudget &budget = world.entity(flecs::OnUpdate).get<stagehand::PhaseTimeBudget>();
+    EXPECT_GT(budget.used_milliseconds, SMALL_BUDGET_MILLISECONDS);
+}
+
+TEST_F(TimeSlicedFixture, PassEndsWhenRowsAfterCursorAreGone) {
+    flecs::system system = register_counter("test::Budgeted", true);
+    std::vector<flecs::entity> entities = create_counted_entities(world, 3);
+    stagehand::set_phase_time_budget(world, flecs::OnUpdate, SMALL_BUDGET_MILLISECONDS);
+
+    world.progress(0.016f);
+    ASSERT_EQ(system.get<stagehand::TimeSlicedCursor>().row, 1);
+
+    entities[1].destruct();
+    entities[2].destruct();
+    world.progress(0.016f);
+
+    // The emptied pass ends, and the next one processes entities[0] and ends too.
+    EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().completed_passes, 2);
+    EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().processed_entities, 1);
+    EXPECT_EQ(entities[0].get<WorkCounter>().value, 2);
+}
+
+TEST_F(TimeSlicedFixture, RestartsWhenCursorTableNoLongerMatches) {
+    flecs::system system = register_counter("test::Budgeted", true);
+    std::vector<flecs::entity> entities = create_counted_entities(world, 4);
+    entities[2].add<OtherTable>();
+    entities[3].add<OtherTable>();
+    stagehand::set_phase_time_budget(world, flecs::OnUpdate, SMALL_BUDGET_MILLISECONDS);
+
+    // Stop in the middle of the second table, then empty it.
+    for (int frame = 0; frame < 3; ++frame) {
+        world.progress(0.016f);
+    }
+    ASSERT_NE(system.get<stagehand::TimeSlicedCursor>().table, nullptr);
+    entities[2].remove<OtherTable>();
+    entities[3].remove<OtherTable>();
+    const int32_t before = total_work(entities);
+
+    world.progress(0.016f);
+    EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().processed_entities, 1) << "The run starts over instead of processing nothing";
+    EXPECT_EQ(system.get<stagehand::TimeSlicedCursor>().completed_passes, 1);
+    EXPECT_EQ(total_work(entities), before + 1);
+}
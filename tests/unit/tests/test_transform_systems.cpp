@@ -195,6 +195,29 @@ TEST_F(TransformSystemFixture, DecomposeSystemRunsAndExtractsComponents3D) {
     ASSERT_NEAR(scale->z, 4.0f, EPSILON);
 }
 
+TEST_F(TransformSystemFixture, ComposeSystemWritesRenderTransform3D) {
+    stagehand::entity entity = world.entity();
+    entity.set<stagehand::transform::Position3D>(stagehand::transform::Position3D(godot::Vector3(10, 20, 30)));
+    entity.set<stagehand::transform::Rotation3D>(stagehand::transform::Rotation3D(godot::Quaternion(godot::Vector3(0, 1, 0), 0.5f)));
+    entity.set<stagehand::transform::Scale3D>(stagehand::transform::Scale3D(godot::Vector3(2, 3, 4)));
+    static_cast<flecs::entity>(entity).set<stagehand::transform::Transform3D>(stagehand::transform::Transform3D());
+    entity.add<stagehand::transform::RenderTransform3D>();
+
+    ecs_run(world.c_ptr(), world.lookup(stagehand::names::systems::TRANSFORM_COMPOSE_3D).id(), 0.0f, nullptr);
+
+    // The render transform holds the rows of the composed transform, each followed by the matching origin component.
+    const godot::Transform3D &transform = entity.get<stagehand::transform::Transform3D>();
+    const stagehand::transform::RenderTransform3D &render_transform = entity.get<stagehand::transform::RenderTransform3D>();
+    for (int row = 0; row < 3; ++row) {
+        ASSERT_NEAR(render_transform.data[row * 4 + 0], transform.basis.rows[row].x, EPSILON);
+        ASSERT_NEAR(render_transform.data[row * 4 + 1], transform.basis.rows[row].y, EPSILON);
+        ASSERT_NEAR(render_transform.data[row * 4 + 2], transform.basis.rows[row].z, EPSILON);
+    }
+    ASSERT_NEAR(render_transform.data[3], 10.0f, EPSILON);
+    ASSERT_NEAR(render_transform.data[7], 20.0f, EPSILON);
+    ASSERT_NEAR(render_transform.data[11], 30.0f, EPSILON);
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Transform systems are registered by name
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -0,0 +1,158 @@
+/// Unit tests for typed events declared with the EVENT macro.
+/// Tests verify:
+///   1. EVENT registers the event type and a world-owned buffer.
+///   2. emit_event queues events that for_each_event reads back in order, with their source.
+///   3. drain_typed_events clears the buffers and only asks the sink about event types with queued events.
+///   4. Buffers keep their capacity across frames.
+///   5. Multi-threaded systems can emit: every stage gets its own lane and no event is lost.
+
+#include <cstring>
+#include <vector>
+
+#include <flecs.h>
+#include <gtest/gtest.h>
+
+#include "stagehand/ecs/components/typed_event.h"
+#include "stagehand/registry.h"
+
+namespace test_typed_events {
+    EVENT(Damaged, {
+        float amount = 0.0f;
+        int32_t attacker = 0;
+    });
+
+    EVENT(Healed, { float amount = 0.0f; });
+} // namespace test_typed_events
+
+using test_typed_events::Damaged;
+using test_typed_events::Healed;
+
+namespace {
+    struct Healer {
+        float amount = 0.0f;
+    };
+
+    struct TypedEventFixture : ::testing::Test {
+        flecs::world world;
+
+        void SetUp() override { stagehand::register_components_and_systems_with_world(world); }
+    };
+
+    /// A sink that records which event types it was asked about and never accepts events, so no Dictionary is built.
+    class RecordingSink : public stagehand::TypedEventSink {
+      public:
+        mutable std::vector<size_t> queried;
+
+        bool wants(size_t event_type_index) const override {
+            queried.push_back(event_type_index);
+            return false;
+        }
+        void deliver(size_t, const godot::Dictionary &, flecs::entity_t) override { FAIL() << "deliver() called although wants() returned false"; }
+    };
+
+    size_t find_event_type(const char *name) {
+        const std::vector<stagehand::TypedEventType> &types = stagehand::internal::get_typed_event_types();
+        for (size_t i = 0; i < types.size(); ++i) {
+            if (std::strcmp(types[i].name, name) == 0) {
+                return i;
+            }
+        }
+        return types.size();
+    }
+
+    std::vector<Damaged> collect_damaged(const flecs::world &world, std::vector<flecs::entity_t> *sources = nullptr) {
+        std::vector<Damaged> events;
+        stagehand::for_each_event<Damaged>(world, [&](const Damaged &event, flecs::entity_t source) {
+            events.push_back(event);
+            if (sources) {
+                sources->push_back(source);
+            }
+        });
+        return events;
+    }
+} // namespace
+
+TEST_F(TypedEventFixture, EventTypesAreRegistered) {
+    EXPECT_LT(find_event_type("Damaged"), stagehand::internal::get_typed_event_types().size());
+    EXPECT_LT(find_event_type("Healed"), stagehand::internal::get_typed_event_types().size());
+    EXPECT_NE(world.try_get<stagehand::internal::EventBuffer<Damaged>>(), nullptr);
+    EXPECT_NE(world.try_get<stagehand::internal::EventBuffer<Healed>>(), nullptr);
+}
+
+TEST_F(TypedEventFixture, EmittedEventsAreReadInOrder) {
+    const flecs::entity attacker = world.entity("Attacker");
+    stagehand::emit_event(world, Damaged{1.5f, 7});
+    stagehand::emit_event(attacker, Damaged{3.0f, 8});
+
+    std::vector<flecs::entity_t> sources;
+    const std::vector<Damaged> events = collect_damaged(world, &sources);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_FLOAT_EQ(events[0].amount, 1.5f);
+    EXPECT_EQ(events[0].attacker, 7);
+    EXPECT_FLOAT_EQ(events[1].amount, 3.0f);
+    EXPECT_EQ(sources[0], 0u);
+    EXPECT_EQ(sources[1], attacker.id());
+}
+
+TEST_F(TypedEventFixture, EventsFromSystemsAreVisibleToLaterSystems) {
+    int consumed = 0;
+    world.system("Emitter").kind(flecs::OnUpdate).run([](flecs::iter &it) { stagehand::emit_event(it.world(), Healed{2.0f}); });
+    world.system("Consumer").kind(flecs::PostUpdate).run([&consumed](flecs::iter &it) {
+        stagehand::for_each_event<Healed>(it.world(), [&consumed](const Healed &, flecs::entity_t) { ++consumed; });
+    });
+
+    world.progress();
+    EXPECT_EQ(consumed, 1);
+}
+
+TEST_F(TypedEventFixture, DrainClearsBuffersAndOnlyQueriesQueuedTypes) {
+    stagehand::emit_event(world, Damaged{1.0f, 1});
+
+    RecordingSink sink;
+    stagehand::drain_typed_events(world, &sink);
+
+    ASSERT_EQ(sink.queried.size(), 1u);
+    EXPECT_EQ(sink.queried[0], find_event_type("Damaged"));
+    EXPECT_TRUE(collect_damaged(world).empty());
+}
+
+TEST_F(TypedEventFixture, BuffersKeepTheirCapacity) {
+    for (int i = 0; i < 64; ++i) {
+        stagehand::emit_event(world, Damaged{static_cast<float>(i), i});
+    }
+    stagehand::drain_typed_events(world);
+    stagehand::drain_typed_events(world);
+
+    const stagehand::internal::EventBuffer<Damaged> *buffer = world.try_get<stagehand::internal::EventBuffer<Damaged>>();
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_TRUE(buffer->entries.empty());
+    EXPECT_GE(buffer->delivering.capacity(), 64u);
+}
+
+TEST_F(TypedEventFixture, MultiThreadedSystemsEmitIntoPerStageLanes) {
+    constexpr int kEntityCount = 1000;
+    for (int i = 0; i < kEntityCount; ++i) {
+        world.entity().set<Healer>({1.0f});
+    }
+    world.set_threads(4);
+
+    int consumed = 0;
+    float total = 0.0f;
+    world.system<const Healer>("Threaded Emitter").kind(flecs::OnUpdate).multi_threaded().each([](flecs::iter &it, size_t row, const Healer &healer) {
+        stagehand::emit_event(it, row, Healed{healer.amount});
+    });
+    world.system("Threaded Consumer").kind(flecs::PostUpdate).run([&](flecs::iter &it) {
+        stagehand::for_each_event<Healed>(it.world(), [&](const Healed &event, flecs::entity_t source) {
+            ++consumed;
+            total += event.amount;
+            EXPECT_NE(source, 0u);
+        });
+    });
+
+    world.progress();
+    EXPECT_EQ(consumed, kEntityCount);
+    EXPECT_FLOAT_EQ(total, static_cast<float>(kEntityCount));
+
+    stagehand::drain_typed_events(world);
+    EXPECT_TRUE(world.try_get<stagehand::internal::EventBuffer<Healed>>()->entries.empty());
+}
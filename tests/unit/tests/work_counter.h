@@ -0,0 +1,33 @@
+/// Component and helpers shared by the unit tests of systems that only process some of their entities per run.
+#pragma once
+
+#include <cstdint>
+#include <flecs.h>
+#include <vector>
+
+namespace stagehand_tests {
+    /// Counts how often a test system processed the entity.
+    struct WorkCounter {
+        int32_t value = 0;
+        /// Sum of the delta times the entity was processed with.
+        float total_time = 0.0f;
+    };
+
+    /// Creates `count` entities with nothing but a WorkCounter.
+    inline std::vector<flecs::entity> create_counted_entities(flecs::world &world, int count) {
+        std::vector<flecs::entity> entities;
+        for (int i = 0; i < count; ++i) {
+            entities.push_back(world.entity().set<WorkCounter>({}));
+        }
+        return entities;
+    }
+
+    /// Returns the sum of the WorkCounter values of `entities`.
+    inline int32_t total_work(const std::vector<flecs::entity> &entities) {
+        int32_t sum = 0;
+        for (const flecs::entity &entity : entities) {
+            sum += entity.get<WorkCounter>().value;
+        }
+        return sum;
+    }
+} // namespace stagehand_tests